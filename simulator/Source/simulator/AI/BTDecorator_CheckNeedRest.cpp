@@ -2,6 +2,7 @@
 
 #include "BTDecorator_CheckNeedRest.h"
 #include "BehaviorTree/BlackboardComponent.h"
+#include "SimulationRandomSubsystem.h"
 
 UBTDecorator_CheckNeedRest::UBTDecorator_CheckNeedRest()
 {
@@ -31,7 +32,7 @@ bool UBTDecorator_CheckNeedRest::CalculateRawConditionValue(UBehaviorTreeCompone
 	}
 
 	// Random chance to need rest
-	if (RandomRestChance > 0.0f && FMath::FRand() < RandomRestChance)
+	if (RandomRestChance > 0.0f && USimulationRandomSubsystem::GetWorldStream(OwnerComp.GetOwner(), TEXT("VillagerAI")).FRand() < RandomRestChance)
 	{
 		UE_LOG(LogTemp, Log, TEXT("Need rest: Random chance triggered"));
 		return true;
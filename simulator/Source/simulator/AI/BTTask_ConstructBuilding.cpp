@@ -5,7 +5,7 @@
 #include "BaseVillager.h"
 #include "ConstructionSite.h"
 #include "BehaviorTree/BlackboardComponent.h"
-#include "EngineUtils.h"
+#include "BuildingManagerSubsystem.h"
 
 UBTTask_ConstructBuilding::UBTTask_ConstructBuilding()
 {
@@ -167,13 +167,18 @@ AConstructionSite* UBTTask_ConstructBuilding::FindNearestConstructionSite(ABaseV
 		return nullptr;
 	}
 
+	UBuildingManagerSubsystem* BuildingManager = Villager->GetWorld()->GetSubsystem<UBuildingManagerSubsystem>();
+	if (!BuildingManager)
+	{
+		return nullptr;
+	}
+
 	AConstructionSite* NearestSite = nullptr;
 	float NearestDistance = FLT_MAX;
 
-	// 월드의 모든 건설 현장 검색
-	for (TActorIterator<AConstructionSite> It(Villager->GetWorld()); It; ++It)
+	// 등록된 건설 현장 검색
+	for (AConstructionSite* Site : BuildingManager->GetConstructionSitesView())
 	{
-		AConstructionSite* Site = *It;
 		if (Site && Site->bIsActive && Site->HasAvailableWorkerSlots())
 		{
 			float Distance = FVector::Dist(Villager->GetActorLocation(), Site->GetConstructionLocation());
@@ -78,8 +78,8 @@ EBTNodeResult::Type UBTTask_DepositResources::ExecuteTask(UBehaviorTreeComponent
 		return EBTNodeResult::Failed; // Need to move closer first
 	}
 
-	// Transfer all resources from villager to storage
-	TArray<FResourceStack> VillagerResources = Villager->Inventory->GetAllResources();
+	// Transfer all resources from villager to storage (snapshot by value - no allocation)
+	FResourceVector VillagerResources = Villager->Inventory->GetResources();
 	int32 TotalDeposited = 0;
 
 	for (const FResourceStack& Stack : VillagerResources)
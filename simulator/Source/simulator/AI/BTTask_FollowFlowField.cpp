@@ -0,0 +1,140 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "BTTask_FollowFlowField.h"
+#include "AIController.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "BehaviorTree/BlackboardComponent.h"
+#include "BaseVillager.h"
+#include "BaseBuilding.h"
+#include "FlowFieldSubsystem.h"
+#include "ActionBudgetController.h"
+
+UBTTask_FollowFlowField::UBTTask_FollowFlowField()
+{
+	NodeName = "Follow Flow Field";
+	bNotifyTick = true;
+	bNotifyTaskFinished = true;
+
+	bTargetBuilding = false;
+	TargetZoneType = ETerrainZone::Farmland;
+	TargetBuildingKey = FName("TargetBuilding");
+	AcceptanceRadius = 200.0f;
+	bShouldRun = false;
+}
+
+EBTNodeResult::Type UBTTask_FollowFlowField::ExecuteTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
+{
+	AAIController* AIController = OwnerComp.GetAIOwner();
+	ABaseVillager* Villager = AIController ? Cast<ABaseVillager>(AIController->GetPawn()) : nullptr;
+	if (!Villager)
+	{
+		return EBTNodeResult::Failed;
+	}
+
+	// Set movement speed
+	UCharacterMovementComponent* Movement = Villager->GetCharacterMovement();
+	if (Movement)
+	{
+		Movement->MaxWalkSpeed = bShouldRun ? Villager->RunSpeed : Villager->WalkSpeed;
+	}
+
+	EBTNodeResult::Type Result = UpdateSteering(OwnerComp);
+	if (Result == EBTNodeResult::InProgress)
+	{
+		Villager->CurrentState = EActorState::MOVING;
+	}
+	return Result;
+}
+
+void UBTTask_FollowFlowField::TickTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds)
+{
+	// Steering is part of the villager's action cost
+	FScopedActionCost ActionCost(OwnerComp.GetAIOwner());
+
+	EBTNodeResult::Type Result = UpdateSteering(OwnerComp);
+	if (Result != EBTNodeResult::InProgress)
+	{
+		FinishLatentTask(OwnerComp, Result);
+	}
+}
+
+void UBTTask_FollowFlowField::OnTaskFinished(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTNodeResult::Type TaskResult)
+{
+	AAIController* AIController = OwnerComp.GetAIOwner();
+	if (AIController)
+	{
+		ABaseVillager* Villager = Cast<ABaseVillager>(AIController->GetPawn());
+		if (Villager && Villager->CurrentState == EActorState::MOVING)
+		{
+			Villager->CurrentState = EActorState::IDLE;
+		}
+	}
+
+	Super::OnTaskFinished(OwnerComp, NodeMemory, TaskResult);
+}
+
+EBTNodeResult::Type UBTTask_FollowFlowField::UpdateSteering(UBehaviorTreeComponent& OwnerComp)
+{
+	AAIController* AIController = OwnerComp.GetAIOwner();
+	ABaseVillager* Villager = AIController ? Cast<ABaseVillager>(AIController->GetPawn()) : nullptr;
+	if (!Villager)
+	{
+		return EBTNodeResult::Failed;
+	}
+
+	UFlowFieldSubsystem* FlowFields = Villager->GetWorld()->GetSubsystem<UFlowFieldSubsystem>();
+	if (!FlowFields)
+	{
+		return EBTNodeResult::Failed;
+	}
+
+	const FVector CurrentLocation = Villager->GetActorLocation();
+	FVector Direction = FVector::ZeroVector;
+
+	if (bTargetBuilding)
+	{
+		UBlackboardComponent* BlackboardComp = OwnerComp.GetBlackboardComponent();
+		ABaseBuilding* TargetBuilding = BlackboardComp ? Cast<ABaseBuilding>(BlackboardComp->GetValueAsObject(TargetBuildingKey)) : nullptr;
+		if (!TargetBuilding)
+		{
+			return EBTNodeResult::Failed;
+		}
+
+		const FVector TargetLocation = TargetBuilding->GetBuildingLocation();
+		if (FVector::Dist2D(CurrentLocation, TargetLocation) <= AcceptanceRadius)
+		{
+			return EBTNodeResult::Succeeded;
+		}
+
+		if (!FlowFields->SampleBuildingFlow(TargetBuilding, CurrentLocation, Direction))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("%s: No flow path to building %s"),
+				*Villager->GetName(), *TargetBuilding->BuildingName);
+			return EBTNodeResult::Failed;
+		}
+
+		// On the footprint cells - walk straight in for the last stretch
+		if (Direction.IsZero())
+		{
+			Direction = (TargetLocation - CurrentLocation).GetSafeNormal2D();
+		}
+	}
+	else
+	{
+		if (!FlowFields->SampleZoneFlow(TargetZoneType, CurrentLocation, Direction))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("%s: No flow path to %s zone"),
+				*Villager->GetName(), *UEnum::GetValueAsString(TargetZoneType));
+			return EBTNodeResult::Failed;
+		}
+
+		// Inside the target zone
+		if (Direction.IsZero())
+		{
+			return EBTNodeResult::Succeeded;
+		}
+	}
+
+	Villager->AddMovementInput(Direction, 1.0f);
+	return EBTNodeResult::InProgress;
+}
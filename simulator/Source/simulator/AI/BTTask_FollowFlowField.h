@@ -0,0 +1,50 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BehaviorTree/BTTaskNode.h"
+#include "SimulatorTypes.h"
+#include "BTTask_FollowFlowField.generated.h"
+
+/**
+ * Behavior Tree task to walk toward a zone type or building by steering along
+ * a shared flow field (FlowFieldSubsystem) instead of planning an own path.
+ * Cheap per agent, meant for mass commutes of many villagers to the same goal.
+ */
+UCLASS()
+class SIMULATOR_API UBTTask_FollowFlowField : public UBTTaskNode
+{
+	GENERATED_BODY()
+
+public:
+	UBTTask_FollowFlowField();
+
+	virtual EBTNodeResult::Type ExecuteTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
+	virtual void TickTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds) override;
+	virtual void OnTaskFinished(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTNodeResult::Type TaskResult) override;
+
+protected:
+	// Head for the building in TargetBuildingKey instead of a zone type
+	UPROPERTY(EditAnywhere, Category = "AI")
+	bool bTargetBuilding;
+
+	// Target zone type to move to
+	UPROPERTY(EditAnywhere, Category = "AI", meta = (EditCondition = "!bTargetBuilding"))
+	ETerrainZone TargetZoneType;
+
+	// Blackboard key holding the target building
+	UPROPERTY(EditAnywhere, Category = "Blackboard", meta = (EditCondition = "bTargetBuilding"))
+	FName TargetBuildingKey;
+
+	// How close we need to get to a target building
+	UPROPERTY(EditAnywhere, Category = "Movement")
+	float AcceptanceRadius;
+
+	// Should we run or walk?
+	UPROPERTY(EditAnywhere, Category = "Movement")
+	bool bShouldRun;
+
+	// Sample the field and apply movement input (InProgress while still walking)
+	EBTNodeResult::Type UpdateSteering(UBehaviorTreeComponent& OwnerComp);
+};
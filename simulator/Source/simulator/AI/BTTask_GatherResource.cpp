@@ -66,7 +66,12 @@ EBTNodeResult::Type UBTTask_GatherResource::ExecuteTask(UBehaviorTreeComponent&
 	}
 
 	// Get zone type at work location
-	ETerrainZone WorkZoneType = ZoneGrid->GetZoneTypeAtLocation(WorkLocation);
+	ETerrainZone WorkZoneType = ETerrainZone::Farmland;
+	if (!ZoneGrid->TryGetZoneTypeAtLocation(WorkLocation, WorkZoneType))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("%s: Work location zone is unknown (outside the grid or not loaded yet)"), *Villager->GetName());
+		return EBTNodeResult::Failed;
+	}
 
 	// Verify zone type matches (if we care about specific type)
 	if (WorkZoneType != TargetZoneType && TargetZoneType != ETerrainZone::Farmland)
@@ -106,12 +111,24 @@ EBTNodeResult::Type UBTTask_GatherResource::ExecuteTask(UBehaviorTreeComponent&
 		break;
 	}
 
-	// Gather resources (simplified - just add to inventory)
-	// TODO: Add resource depletion/regeneration system to ZoneGrid cells
-	int32 AmountAdded = Villager->Inventory->AddResource(ResourceType, GatherAmount);
+	// Yield scales with remaining cell richness (depleted cells yield less)
+	float Richness = ZoneGrid->GetAvailableRichnessAtLocation(WorkLocation);
+	int32 YieldAmount = FMath::RoundToInt(GatherAmount * Richness);
+
+	if (YieldAmount <= 0)
+	{
+		UE_LOG(LogTemp, Log, TEXT("%s: %s zone is depleted, nothing to gather"),
+			*Villager->GetName(), *UEnum::GetValueAsString(WorkZoneType));
+		return EBTNodeResult::Failed;
+	}
+
+	int32 AmountAdded = Villager->Inventory->AddResource(ResourceType, YieldAmount);
 
 	if (AmountAdded > 0)
 	{
+		// Depletion is applied in batch at the next territory turn
+		ZoneGrid->QueueGatherEvent(WorkLocation, AmountAdded);
+
 		UE_LOG(LogTemp, Log, TEXT("%s: Gathered %d x %s from %s zone"),
 			*Villager->GetName(),
 			AmountAdded,
@@ -53,33 +53,29 @@ EBTNodeResult::Type UBTTask_MoveToZone::ExecuteTask(UBehaviorTreeComponent& Owne
 
 	// Check current location zone type
 	FVector CurrentLocation = Villager->GetActorLocation();
-	ETerrainZone CurrentZoneType = ZoneGrid->GetZoneTypeAtLocation(CurrentLocation);
+	ETerrainZone CurrentZoneType = ETerrainZone::Farmland;
+	const bool bKnownZone = ZoneGrid->TryGetZoneTypeAtLocation(CurrentLocation, CurrentZoneType);
 
-	// Already in target zone type?
-	if (CurrentZoneType == TargetZoneType)
+	// Already in target zone type? (unknown cells never count)
+	if (bKnownZone && CurrentZoneType == TargetZoneType)
 	{
 		UE_LOG(LogTemp, Log, TEXT("%s: Already in %s zone"),
 			*Villager->GetName(), *UEnum::GetValueAsString(TargetZoneType));
 		return EBTNodeResult::Succeeded;
 	}
 
-	// Find nearest cell of target zone type
+	// Find nearest cell of target zone type (precomputed nearest-zone field lookup)
 	FVector TargetLocation = FVector::ZeroVector;
 	float MinDistance = MaxSearchDistance;
 	bool bFoundZone = false;
 
-	// Simple search through all cells (could be optimized with spatial partitioning)
-	for (const FZoneCellData& Cell : ZoneGrid->ZoneCells)
+	if (ZoneGrid->FindNearestZoneCell(CurrentLocation, TargetZoneType, TargetLocation))
 	{
-		if (Cell.ZoneType == TargetZoneType)
+		float Distance = FVector::Dist(CurrentLocation, TargetLocation);
+		if (Distance < MaxSearchDistance)
 		{
-			float Distance = FVector::Dist(CurrentLocation, Cell.WorldPosition);
-			if (Distance < MinDistance)
-			{
-				MinDistance = Distance;
-				TargetLocation = Cell.WorldPosition;
-				bFoundZone = true;
-			}
+			MinDistance = Distance;
+			bFoundZone = true;
 		}
 	}
 
@@ -6,6 +6,7 @@
 #include "BaseBuilding.h"
 #include "House.h"
 #include "BuildingManagerSubsystem.h"
+#include "SimulationRandomSubsystem.h"
 #include "BehaviorTree/BlackboardComponent.h"
 
 UBTTask_Rest::UBTTask_Rest()
@@ -93,7 +94,7 @@ EBTNodeResult::Type UBTTask_Rest::ExecuteTask(UBehaviorTreeComponent& OwnerComp,
 	float ActualRestTime = RestDuration;
 	if (RandomDeviation > 0.0f)
 	{
-		ActualRestTime += FMath::RandRange(-RandomDeviation, RandomDeviation);
+		ActualRestTime += USimulationRandomSubsystem::GetWorldStream(Villager, TEXT("VillagerAI")).FRandRange(-RandomDeviation, RandomDeviation);
 		ActualRestTime = FMath::Max(1.0f, ActualRestTime); // Minimum 1 second
 	}
 
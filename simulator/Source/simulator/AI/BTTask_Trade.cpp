@@ -7,8 +7,8 @@
 #include "InventoryComponent.h"
 #include "BaseBuilding.h"
 #include "BuildingManagerSubsystem.h"
+#include "VillagerManagerSubsystem.h"
 #include "BehaviorTree/BlackboardComponent.h"
-#include "EngineUtils.h"
 
 UBTTask_Trade::UBTTask_Trade()
 {
@@ -77,15 +77,18 @@ EBTNodeResult::Type UBTTask_Trade::ExecuteTask(UBehaviorTreeComponent& OwnerComp
 		return EBTNodeResult::Failed;
 	}
 
-	// Find a merchant at the market
+	// Find a merchant at the market (registered merchants only, no world scan)
 	AMerchantVillager* Merchant = nullptr;
-	for (TActorIterator<AMerchantVillager> It(Villager->GetWorld()); It; ++It)
+	if (UVillagerManagerSubsystem* VillagerManager = Villager->GetWorld()->GetSubsystem<UVillagerManagerSubsystem>())
 	{
-		AMerchantVillager* PotentialMerchant = *It;
-		if (PotentialMerchant && PotentialMerchant->AssignedMarket == Market)
+		for (ABaseVillager* MerchantVillager : VillagerManager->GetVillagersByRoleView(EVillagerRole::Merchant))
 		{
-			Merchant = PotentialMerchant;
-			break;
+			AMerchantVillager* PotentialMerchant = Cast<AMerchantVillager>(MerchantVillager);
+			if (PotentialMerchant && PotentialMerchant->AssignedMarket == Market)
+			{
+				Merchant = PotentialMerchant;
+				break;
+			}
 		}
 	}
 
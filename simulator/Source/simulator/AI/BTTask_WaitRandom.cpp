@@ -1,6 +1,7 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "BTTask_WaitRandom.h"
+#include "SimulationRandomSubsystem.h"
 
 UBTTask_WaitRandom::UBTTask_WaitRandom()
 {
@@ -13,7 +14,7 @@ UBTTask_WaitRandom::UBTTask_WaitRandom()
 EBTNodeResult::Type UBTTask_WaitRandom::ExecuteTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
 {
 	FWaitTaskMemory* Memory = CastInstanceNodeMemory<FWaitTaskMemory>(NodeMemory);
-	Memory->RemainingTime = FMath::RandRange(MinWaitTime, MaxWaitTime);
+	Memory->RemainingTime = USimulationRandomSubsystem::GetWorldStream(OwnerComp.GetOwner(), TEXT("VillagerAI")).FRandRange(MinWaitTime, MaxWaitTime);
 
 	return EBTNodeResult::InProgress;
 }
@@ -49,11 +49,10 @@ EBTNodeResult::Type UBTTask_WithdrawResources::ExecuteTask(UBehaviorTreeComponen
 	}
 
 	// Find storage buildings with the desired resource
-	TArray<ABaseBuilding*> StorageBuildings = BuildingManager->GetAllStorageBuildings();
 	ABaseBuilding* TargetStorage = nullptr;
 	float NearestDistance = FLT_MAX;
 
-	for (ABaseBuilding* Storage : StorageBuildings)
+	for (ABaseBuilding* Storage : BuildingManager->GetStorageBuildingsView())
 	{
 		if (Storage && Storage->Inventory && Storage->Inventory->HasResource(ResourceType, WithdrawAmount))
 		{
@@ -9,6 +9,9 @@ ABakery::ABakery()
 	BuildingType = EBuildingType::Bakery;
 	BuildingName = TEXT("Bakery");
 
+	// Placed on settlement zone cells
+	bRequiresZonePlacement = true;
+
 	// Production settings
 	bCanProduce = true;
 	bIsOperational = true;
@@ -9,6 +9,9 @@ ABarracks::ABarracks()
 	BuildingType = EBuildingType::TownHall; // 임시로 TownHall 사용 (나중에 Barracks 추가 필요)
 	BuildingName = TEXT("Barracks");
 
+	// 정착지 구역에만 배치
+	bRequiresZonePlacement = true;
+
 	MaxGarrison = 20;
 	MaxWorkers = 5;
 
@@ -5,6 +5,13 @@
 #include "Components/StaticMeshComponent.h"
 #include "BaseVillager.h"
 #include "Territory.h"
+#include "ResourceManagerSubsystem.h"
+#include "BuildingManagerSubsystem.h"
+
+// Raw producers must not inherit the settlement placement zone
+static_assert(GetZoneForBuildingType(EBuildingType::Farm) == ETerrainZone::Farmland, "Farms are placed on farmland");
+static_assert(GetZoneForBuildingType(EBuildingType::IronMine) == ETerrainZone::Mountain, "Mines are placed on mountains");
+static_assert(GetZoneForBuildingType(EBuildingType::Warehouse) == ETerrainZone::Settlement, "Storage is placed in settlements");
 
 ABaseBuilding::ABaseBuilding()
 {
@@ -28,6 +35,11 @@ ABaseBuilding::ABaseBuilding()
 	MaxWorkers = 1;
 	CurrentWorkers = 0;
 
+	// Placement defaults (zone check is opt-in; subclasses that need it turn it on)
+	FootprintSize = FVector2D(1000.0f, 1000.0f);
+	RequiredZoneType = GetZoneForBuildingType(BuildingType);
+	bRequiresZonePlacement = false;
+
 	// Production defaults
 	bCanProduce = false;
 	OptimalWorkerCount = 3;
@@ -88,10 +100,56 @@ void ABaseBuilding::BeginPlay()
 		BuildingName = TypeName;
 	}
 
+	// Storage contents count toward the world's resource totals
+	if (IsStorageBuilding() && Inventory)
+	{
+		if (UResourceManagerSubsystem* ResourceManager = GetWorld()->GetSubsystem<UResourceManagerSubsystem>())
+		{
+			ResourceManager->RegisterStorageInventory(Inventory);
+		}
+	}
+
+	// Building queries only see registered buildings
+	if (UBuildingManagerSubsystem* BuildingManager = GetWorld()->GetSubsystem<UBuildingManagerSubsystem>())
+	{
+		BuildingManager->RegisterBuilding(this);
+	}
+
 	UE_LOG(LogTemp, Log, TEXT("Building '%s' initialized - Type: %s, Operational: %s"),
 		*BuildingName, *TypeName, bIsOperational ? TEXT("Yes") : TEXT("No"));
 }
 
+void ABaseBuilding::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UBuildingManagerSubsystem* BuildingManager = GetWorld()->GetSubsystem<UBuildingManagerSubsystem>())
+	{
+		BuildingManager->UnregisterBuilding(this);
+	}
+
+	if (Inventory)
+	{
+		if (UResourceManagerSubsystem* ResourceManager = GetWorld()->GetSubsystem<UResourceManagerSubsystem>())
+		{
+			ResourceManager->UnregisterStorageInventory(Inventory);
+		}
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+#if WITH_EDITOR
+void ABaseBuilding::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	// A Blueprint switched to e.g. Farm should be placed on farmland, not the settlement default
+	if (PropertyChangedEvent.GetPropertyName() == GET_MEMBER_NAME_CHECKED(ABaseBuilding, BuildingType))
+	{
+		RequiredZoneType = GetZoneForBuildingType(BuildingType);
+	}
+}
+#endif
+
 bool ABaseBuilding::CanAcceptResources() const
 {
 	if (!bIsOperational || !Inventory)
@@ -256,9 +314,30 @@ bool ABaseBuilding::HasInputResources() const
 	return true;
 }
 
-TMap<EResourceType, int32> ABaseBuilding::CalculateProduction()
+FResourceVector ABaseBuilding::CalculateProduction()
+{
+	FResourceVector Stock;
+	if (OwnerTerritory)
+	{
+		Stock = OwnerTerritory->TerritoryResources;
+	}
+
+	TArray<FResourceStack> ConsumedInputs;
+	FResourceVector Production = PreviewProduction(OwnerTerritory ? &Stock : nullptr, ConsumedInputs);
+
+	// Consume input resources from territory warehouse
+	for (const FResourceStack& Input : ConsumedInputs)
+	{
+		OwnerTerritory->RemoveResource(Input.ResourceType, Input.Quantity);
+	}
+
+	return Production;
+}
+
+FResourceVector ABaseBuilding::PreviewProduction(FResourceVector* Stock, TArray<FResourceStack>& OutConsumedInputs) const
 {
-	TMap<EResourceType, int32> Production;
+	FResourceVector Production;
+	OutConsumedInputs.Reset();
 
 	// Can't produce if not operational or no recipe
 	if (!bIsOperational || !bCanProduce)
@@ -268,23 +347,35 @@ TMap<EResourceType, int32> ABaseBuilding::CalculateProduction()
 	if (CurrentWorkers <= 0)
 		return Production;
 
-	// Check if we have input resources (Tier 2/3 buildings)
-	if (!HasInputResources())
+	// Check if we have input resources (Tier 2/3 buildings), same rules as HasInputResources
+	bool bHasInputs = Stock || ProductionRecipe.InputResources.Num() == 0;
+	for (const FResourceStack& Input : ProductionRecipe.InputResources)
 	{
-		// Log why production stopped
-		if (ProductionRecipe.InputResources.Num() > 0)
+		if ((Stock ? Stock->Get(Input.ResourceType) : 0) < Input.Quantity)
 		{
-			UE_LOG(LogTemp, Verbose, TEXT("%s: Production halted - insufficient input resources"), *BuildingName);
+			bHasInputs = false;
+			break;
 		}
+	}
+
+	if (!bHasInputs)
+	{
+		// Log why production stopped
+		UE_LOG(LogTemp, Verbose, TEXT("%s: Production halted - insufficient input resources"), *BuildingName);
 		return Production;
 	}
 
-	// Consume input resources from territory warehouse
-	if (OwnerTerritory && ProductionRecipe.InputResources.Num() > 0)
+	// Consume input resources (mirrors ATerritory::RemoveResource, which skips amounts it can't cover)
+	if (Stock && ProductionRecipe.InputResources.Num() > 0)
 	{
 		for (const FResourceStack& Input : ProductionRecipe.InputResources)
 		{
-			OwnerTerritory->RemoveResource(Input.ResourceType, Input.Quantity);
+			OutConsumedInputs.Add(Input);
+
+			if (Input.Quantity > 0 && Stock->Get(Input.ResourceType) >= Input.Quantity)
+			{
+				Stock->Add(Input.ResourceType, -Input.Quantity);
+			}
 		}
 	}
 
@@ -299,7 +390,7 @@ TMap<EResourceType, int32> ABaseBuilding::CalculateProduction()
 
 		if (ActualProduction > 0)
 		{
-			Production.Add(Output.ResourceType, ActualProduction);
+			Production.Set(Output.ResourceType, ActualProduction);
 		}
 	}
 
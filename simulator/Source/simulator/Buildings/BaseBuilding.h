@@ -21,6 +21,11 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
 
 public:
 	// Building type
@@ -55,6 +60,20 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Building|Construction")
 	FConstructionCost ConstructionCost;
 
+	// === Placement ===
+
+	// Ground area covered by the building (cm, before rotation)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Building|Placement")
+	FVector2D FootprintSize;
+
+	// Zone type every footprint cell must have (follows BuildingType when that is edited)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Building|Placement")
+	ETerrainZone RequiredZoneType;
+
+	// Check the footprint against the zone grid when placing a construction site
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Building|Placement")
+	bool bRequiresZonePlacement;
+
 	// === Production System ===
 
 	// Production recipe for this building (what it produces)
@@ -80,7 +99,11 @@ public:
 	// Calculate production output based on current workers
 	// Returns actual production (after checking input resources)
 	UFUNCTION(BlueprintCallable, Category = "Building|Production")
-	TMap<EResourceType, int32> CalculateProduction();
+	FResourceVector CalculateProduction();
+
+	// Same result as CalculateProduction, but checks and consumes inputs in Stock instead of the territory
+	// (nullptr = no territory). Inputs to remove are listed in OutConsumedInputs. Touches no actor state.
+	FResourceVector PreviewProduction(FResourceVector* Stock, TArray<FResourceStack>& OutConsumedInputs) const;
 
 	// Check if territory has enough input resources for production
 	UFUNCTION(BlueprintCallable, Category = "Building|Production")
@@ -9,6 +9,9 @@ ABlacksmith::ABlacksmith()
 	BuildingType = EBuildingType::Blacksmith;
 	BuildingName = TEXT("Blacksmith");
 
+	// Placed on settlement zone cells
+	bRequiresZonePlacement = true;
+
 	// Production settings
 	bCanProduce = true;
 	bIsOperational = true;
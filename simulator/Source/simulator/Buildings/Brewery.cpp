@@ -9,6 +9,9 @@ ABrewery::ABrewery()
 	BuildingType = EBuildingType::Brewery;
 	BuildingName = TEXT("Brewery");
 
+	// Placed on settlement zone cells
+	bRequiresZonePlacement = true;
+
 	// Production settings
 	bCanProduce = true;
 	bIsOperational = true;
@@ -31,10 +31,27 @@ void AConstructionSite::BeginPlay()
 	ConstructionLocation = GetActorLocation();
 	ConstructionStartTime = GetWorld()->GetTimeSeconds();
 
+	// BuildingManagerSubsystem에 등록
+	if (UBuildingManagerSubsystem* BuildingManager = GetWorld()->GetSubsystem<UBuildingManagerSubsystem>())
+	{
+		BuildingManager->RegisterConstructionSite(this);
+	}
+
 	UE_LOG(LogTemp, Log, TEXT("ConstructionSite created: %s at %s - Required work: %.0f"),
 		*BuildingName, *ConstructionLocation.ToString(), RequiredWorkAmount);
 }
 
+void AConstructionSite::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// BuildingManagerSubsystem에서 등록 해제
+	if (UBuildingManagerSubsystem* BuildingManager = GetWorld()->GetSubsystem<UBuildingManagerSubsystem>())
+	{
+		BuildingManager->UnregisterConstructionSite(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void AConstructionSite::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
@@ -131,12 +148,7 @@ ABaseBuilding* AConstructionSite::CompleteConstruction()
 		UE_LOG(LogTemp, Warning, TEXT("Building constructed: %s at %s"),
 			*NewBuilding->BuildingName, *ConstructionLocation.ToString());
 
-		// BuildingManagerSubsystem에 등록
-		UBuildingManagerSubsystem* BuildingManager = GetWorld()->GetSubsystem<UBuildingManagerSubsystem>();
-		if (BuildingManager)
-		{
-			BuildingManager->RegisterBuilding(NewBuilding);
-		}
+		// 새 건물은 BeginPlay에서 BuildingManagerSubsystem에 등록됨
 
 		// 건설 현장 비활성화 및 제거
 		bIsActive = false;
@@ -9,6 +9,9 @@ AGuildHall::AGuildHall()
 	BuildingType = EBuildingType::GuildHall;
 	BuildingName = TEXT("Guild Hall");
 
+	// Placed on settlement zone cells
+	bRequiresZonePlacement = true;
+
 	MaxWorkers = 1; // Guild master only
 	bCanProduce = false;
 	RequiredSkillLevel = ESkillLevel::Master; // Need master to run guild
@@ -130,7 +133,7 @@ void AGuildHall::ProcessTrainingTurn()
 	CurrentTraining.TurnsCompleted++;
 	CurrentTraining.Progress = (float)CurrentTraining.TurnsCompleted / (float)CurrentTraining.TotalTurns;
 
-	UE_LOG(LogTemp, Log, TEXT("GuildHall: Training progress %s - %d/%d turns (%.0f%%)"),
+	UE_LOG(LogTerritoryTurn, Log, TEXT("GuildHall: Training progress %s - %d/%d turns (%.0f%%)"),
 		*CurrentTraining.Trainee->VillagerName,
 		CurrentTraining.TurnsCompleted,
 		CurrentTraining.TotalTurns,
@@ -10,6 +10,9 @@ AHouse::AHouse()
 	BuildingType = EBuildingType::House;
 	BuildingName = TEXT("House");
 
+	// Placed on settlement zone cells
+	bRequiresZonePlacement = true;
+
 	// Default house capacity
 	MaxResidents = 4;
 	CurrentResidents = 0;
@@ -9,6 +9,9 @@ AMill::AMill()
 	BuildingType = EBuildingType::Mill;
 	BuildingName = TEXT("Mill");
 
+	// Placed on settlement zone cells
+	bRequiresZonePlacement = true;
+
 	// Production settings
 	bCanProduce = true;
 	bIsOperational = true;
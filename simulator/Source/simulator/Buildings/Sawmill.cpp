@@ -9,6 +9,9 @@ ASawmill::ASawmill()
 	BuildingType = EBuildingType::Sawmill;
 	BuildingName = TEXT("Sawmill");
 
+	// Placed on settlement zone cells
+	bRequiresZonePlacement = true;
+
 	// Production settings
 	bCanProduce = true;
 	bIsOperational = true;
@@ -9,6 +9,9 @@ ATannery::ATannery()
 	BuildingType = EBuildingType::Tannery;
 	BuildingName = TEXT("Tannery");
 
+	// Placed on settlement zone cells
+	bRequiresZonePlacement = true;
+
 	// Production settings
 	bCanProduce = true;
 	bIsOperational = true;
@@ -12,6 +12,9 @@ ATradingPost::ATradingPost()
 	BuildingType = EBuildingType::Market;
 	BuildingName = TEXT("Trading Post");
 
+	// 정착지 구역에만 배치
+	bRequiresZonePlacement = true;
+
 	// 건설 비용
 	ConstructionCost.RequiredResources.Add(FResourceStack(EResourceType::Wood, 150));
 	ConstructionCost.RequiredResources.Add(FResourceStack(EResourceType::Stone, 100));
@@ -92,12 +95,7 @@ bool ATradingPost::IsConnectedTo(ATradingPost* Other) const
 
 int32 ATradingPost::GetCurrentStorageAmount() const
 {
-	int32 Total = 0;
-	for (const auto& Pair : StoredResources)
-	{
-		Total += Pair.Value;
-	}
-	return Total;
+	return StoredResources.GetTotal();
 }
 
 bool ATradingPost::HasStorageSpace(int32 Amount) const
@@ -116,17 +114,12 @@ bool ATradingPost::StoreResource(EResourceType ResourceType, int32 Amount)
 		return false;
 	}
 
-	if (!StoredResources.Contains(ResourceType))
-	{
-		StoredResources.Add(ResourceType, 0);
-	}
-
-	StoredResources[ResourceType] += Amount;
+	int32 NewAmount = StoredResources.Add(ResourceType, Amount);
 
 	UE_LOG(LogTemp, Log, TEXT("TradingPost %s stored %d %s (total: %d)"),
 		*TerritoryName, Amount,
 		*UEnum::GetValueAsString(ResourceType),
-		StoredResources[ResourceType]);
+		NewAmount);
 
 	return true;
 }
@@ -135,35 +128,31 @@ bool ATradingPost::WithdrawResource(EResourceType ResourceType, int32 Amount)
 {
 	if (Amount <= 0) return false;
 
-	if (!StoredResources.Contains(ResourceType) || StoredResources[ResourceType] < Amount)
+	if (StoredResources.Get(ResourceType) < Amount)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("TradingPost %s: Not enough %s to withdraw"),
 			*TerritoryName, *UEnum::GetValueAsString(ResourceType));
 		return false;
 	}
 
-	StoredResources[ResourceType] -= Amount;
+	int32 Remaining = StoredResources.Add(ResourceType, -Amount);
 
 	UE_LOG(LogTemp, Log, TEXT("TradingPost %s withdrew %d %s (remaining: %d)"),
 		*TerritoryName, Amount,
 		*UEnum::GetValueAsString(ResourceType),
-		StoredResources[ResourceType]);
+		Remaining);
 
 	return true;
 }
 
 int32 ATradingPost::GetResourceAmount(EResourceType ResourceType) const
 {
-	if (StoredResources.Contains(ResourceType))
-	{
-		return StoredResources[ResourceType];
-	}
-	return 0;
+	return StoredResources.Get(ResourceType);
 }
 
 ACaravan* ATradingPost::SendCaravan(
 	ATradingPost* Destination,
-	TMap<EResourceType, int32> Resources,
+	const FResourceVector& Resources,
 	int32 GuardCount)
 {
 	if (!Destination)
@@ -179,20 +168,24 @@ ACaravan* ATradingPost::SendCaravan(
 	}
 
 	// 자원 인출 확인
-	for (const auto& Pair : Resources)
+	if (!StoredResources.Covers(Resources))
 	{
-		if (GetResourceAmount(Pair.Key) < Pair.Value)
+		for (const FResourceStack& Stack : Resources)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("Not enough %s to send"),
-				*UEnum::GetValueAsString(Pair.Key));
-			return nullptr;
+			if (GetResourceAmount(Stack.ResourceType) < Stack.Quantity)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("Not enough %s to send"),
+					*UEnum::GetValueAsString(Stack.ResourceType));
+				break;
+			}
 		}
+		return nullptr;
 	}
 
 	// 자원 인출
-	for (const auto& Pair : Resources)
+	for (const FResourceStack& Stack : Resources)
 	{
-		WithdrawResource(Pair.Key, Pair.Value);
+		WithdrawResource(Stack.ResourceType, Stack.Quantity);
 	}
 
 	// 상단 생성
@@ -236,9 +229,9 @@ void ATradingPost::ReceiveCaravan(ACaravan* Caravan)
 	else
 	{
 		// 영지 없으면 교역소 창고에 저장
-		for (const auto& Pair : Caravan->CargoResources)
+		for (const FResourceStack& Stack : Caravan->CargoResources)
 		{
-			StoreResource(Pair.Key, Pair.Value);
+			StoreResource(Stack.ResourceType, Stack.Quantity);
 		}
 
 		UE_LOG(LogTemp, Warning, TEXT("TradingPost %s: No territory - storing in local warehouse"),
@@ -62,7 +62,7 @@ public:
 
 	// 교역소 창고 (임시 저장)
 	UPROPERTY(BlueprintReadOnly, Category = "Trading Post|Storage")
-	TMap<EResourceType, int32> StoredResources;
+	FResourceVector StoredResources;
 
 	// 창고 최대 용량
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trading Post|Storage")
@@ -98,7 +98,7 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Trading Post|Caravan")
 	class ACaravan* SendCaravan(
 		ATradingPost* Destination,
-		TMap<EResourceType, int32> Resources,
+		const FResourceVector& Resources,
 		int32 GuardCount = 0
 	);
 
@@ -9,6 +9,9 @@ AWarehouse::AWarehouse()
 	BuildingType = EBuildingType::Warehouse;
 	BuildingName = TEXT("Warehouse");
 
+	// Placed on settlement zone cells
+	bRequiresZonePlacement = true;
+
 	// Warehouses have large capacity
 	if (Inventory)
 	{
@@ -49,11 +52,21 @@ FString AWarehouse::GetStorageSummary() const
 		return TEXT("No inventory");
 	}
 
-	TArray<FResourceStack> Resources = Inventory->GetAllResources();
+	// Unchanged since the last call
+	if (CachedSummaryCapacity == Inventory->MaxCapacity && CachedSummaryVersion == Inventory->GetVersion())
+	{
+		return CachedSummary;
+	}
+
+	CachedSummaryVersion = Inventory->GetVersion();
+	CachedSummaryCapacity = Inventory->MaxCapacity;
 
-	if (Resources.Num() == 0)
+	const FResourceVector& Resources = Inventory->GetResources();
+
+	if (Resources.IsEmpty())
 	{
-		return TEXT("Empty");
+		CachedSummary = TEXT("Empty");
+		return CachedSummary;
 	}
 
 	FString Summary = FString::Printf(TEXT("%d/%d items (%.0f%% full) - "),
@@ -62,18 +75,20 @@ FString AWarehouse::GetStorageSummary() const
 		GetStorageUtilization() * 100.0f);
 
 	// Add resource counts
-	for (int32 i = 0; i < Resources.Num(); i++)
+	bool bFirst = true;
+	for (const FResourceStack& Stack : Resources)
 	{
-		const FResourceStack& Stack = Resources[i];
-		Summary += FString::Printf(TEXT("%d x Type%d"),
-			Stack.Quantity,
-			(int32)Stack.ResourceType);
-
-		if (i < Resources.Num() - 1)
+		if (!bFirst)
 		{
 			Summary += TEXT(", ");
 		}
+		bFirst = false;
+
+		Summary += FString::Printf(TEXT("%d x Type%d"),
+			Stack.Quantity,
+			(int32)Stack.ResourceType);
 	}
 
-	return Summary;
+	CachedSummary = MoveTemp(Summary);
+	return CachedSummary;
 }
@@ -30,7 +30,13 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Warehouse")
 	bool IsNearlyFull() const;
 
-	// Get summary of stored resources
+	// Get summary of stored resources (rebuilt only when the inventory changed)
 	UFUNCTION(BlueprintCallable, Category = "Warehouse")
 	FString GetStorageSummary() const;
+
+private:
+	// Last summary and the inventory version/capacity it was built from
+	mutable FString CachedSummary;
+	mutable uint32 CachedSummaryVersion = 0;
+	mutable int32 CachedSummaryCapacity = -1;
 };
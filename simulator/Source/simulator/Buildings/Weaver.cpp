@@ -9,6 +9,9 @@ AWeaver::AWeaver()
 	BuildingType = EBuildingType::Weaver;
 	BuildingName = TEXT("Weaver");
 
+	// Placed on settlement zone cells
+	bRequiresZonePlacement = true;
+
 	// Production settings
 	bCanProduce = true;
 	bIsOperational = true;
@@ -8,6 +8,8 @@
 #include "Materials/MaterialInstanceDynamic.h"
 #include "VillagerAIController.h"
 #include "TurnManagerSubsystem.h"
+#include "VillagerManagerSubsystem.h"
+#include "SimTrace.h"
 #include "InventoryComponent.h"
 #include "House.h"
 #include "BaseBuilding.h"
@@ -81,6 +83,28 @@ void ABaseVillager::BeginPlay()
 	Super::BeginPlay();
 
 	SetMeshColor();
+
+	// Villager queries only see registered villagers
+	if (UVillagerManagerSubsystem* VillagerManager = GetWorld()->GetSubsystem<UVillagerManagerSubsystem>())
+	{
+		VillagerManager->RegisterVillager(this);
+	}
+}
+
+void ABaseVillager::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UVillagerManagerSubsystem* VillagerManager = GetWorld()->GetSubsystem<UVillagerManagerSubsystem>())
+	{
+		VillagerManager->UnregisterVillager(this);
+	}
+
+	// A queued request would otherwise outlive the villager
+	if (UTurnManagerSubsystem* TurnManager = GetWorld()->GetSubsystem<UTurnManagerSubsystem>())
+	{
+		TurnManager->CancelActorRequests(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void ABaseVillager::SetMeshColor()
@@ -120,6 +144,9 @@ void ABaseVillager::SetMeshColor()
 // Called every frame
 void ABaseVillager::Tick(float DeltaTime)
 {
+	// Frame work while holding an action slot counts toward the turn manager's action budget
+	FScopedActionCost ActionCost(CurrentState != EActorState::IDLE ? this : nullptr);
+
 	Super::Tick(DeltaTime);
 
 }
@@ -177,8 +204,7 @@ void ABaseVillager::OnActionPermissionGranted(EActionType ActionType)
 		break;
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("%s: Action GRANTED - %d, State: %d"),
-		*GetName(), (int32)ActionType, (int32)CurrentState);
+	SIM_TRACE(Villagers, VillagerActionStarted, this, ActionType, CurrentState, 0.0f);
 
 	// TODO: Start the actual action (will be handled by BT)
 }
@@ -189,7 +215,7 @@ void ABaseVillager::CompleteCurrentAction()
 	if (!TurnManager)
 		return;
 
-	UE_LOG(LogTemp, Warning, TEXT("%s: Action COMPLETED - %d"), *GetName(), (int32)CurrentAction);
+	SIM_TRACE(Villagers, VillagerActionCompleted, this, CurrentAction, 0, 0.0f);
 
 	// Notify turn manager
 	TurnManager->NotifyActionComplete(this);
@@ -15,6 +15,9 @@ enum class EVillagerRole : uint8
 	Merchant	UMETA(DisplayName = "Merchant")
 };
 
+// Number of EVillagerRole values (update when the enum grows)
+constexpr int32 NumVillagerRoles = static_cast<int32>(EVillagerRole::Merchant) + 1;
+
 UCLASS()
 class SIMULATOR_API ABaseVillager : public ACharacter
 {
@@ -28,6 +31,9 @@ protected:
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
 
+	// Called when removed from the world
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 public:
 	// Called every frame
 	virtual void Tick(float DeltaTime) override;
@@ -1,6 +1,7 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "InventoryComponent.h"
+#include "SimTrace.h"
 
 UInventoryComponent::UInventoryComponent()
 {
@@ -14,7 +15,7 @@ int32 UInventoryComponent::AddResource(EResourceType ResourceType, int32 Quantit
 		return 0;
 
 	// Check capacity
-	int32 CurrentTotal = GetTotalItems();
+	int32 CurrentTotal = Resources.GetTotal();
 	int32 SpaceAvailable = (MaxCapacity > 0) ? (MaxCapacity - CurrentTotal) : Quantity;
 
 	if (SpaceAvailable <= 0)
@@ -22,94 +23,66 @@ int32 UInventoryComponent::AddResource(EResourceType ResourceType, int32 Quantit
 
 	// Add what we can
 	int32 AmountToAdd = FMath::Min(Quantity, SpaceAvailable);
+	int32 NewQuantity = Resources.Add(ResourceType, AmountToAdd);
+	++Version;
 
-	if (Resources.Contains(ResourceType))
-	{
-		Resources[ResourceType] += AmountToAdd;
-	}
-	else
-	{
-		Resources.Add(ResourceType, AmountToAdd);
-	}
+	SIM_TRACE(Inventory, InventoryAdded, GetOwner(), ResourceType, AmountToAdd, NewQuantity);
 
-	UE_LOG(LogTemp, Log, TEXT("%s: Added %d x %d (Total: %d)"),
-		*GetOwner()->GetName(), (int32)ResourceType, AmountToAdd, Resources[ResourceType]);
+	OnResourceChanged.Broadcast(this, ResourceType, AmountToAdd);
 
 	return AmountToAdd;
 }
 
 int32 UInventoryComponent::RemoveResource(EResourceType ResourceType, int32 Quantity)
 {
-	if (Quantity <= 0 || !Resources.Contains(ResourceType))
+	int32 CurrentQuantity = Resources.Get(ResourceType);
+	if (Quantity <= 0 || CurrentQuantity <= 0)
 		return 0;
 
-	int32 CurrentQuantity = Resources[ResourceType];
 	int32 AmountToRemove = FMath::Min(Quantity, CurrentQuantity);
+	int32 NewQuantity = Resources.Add(ResourceType, -AmountToRemove);
+	++Version;
 
-	Resources[ResourceType] -= AmountToRemove;
-
-	// Remove entry if quantity reaches 0
-	if (Resources[ResourceType] <= 0)
-	{
-		Resources.Remove(ResourceType);
-	}
+	SIM_TRACE(Inventory, InventoryRemoved, GetOwner(), ResourceType, AmountToRemove, NewQuantity);
 
-	UE_LOG(LogTemp, Log, TEXT("%s: Removed %d x %d (Remaining: %d)"),
-		*GetOwner()->GetName(), (int32)ResourceType, AmountToRemove,
-		Resources.Contains(ResourceType) ? Resources[ResourceType] : 0);
+	OnResourceChanged.Broadcast(this, ResourceType, -AmountToRemove);
 
 	return AmountToRemove;
 }
 
 bool UInventoryComponent::HasResource(EResourceType ResourceType, int32 Quantity) const
 {
-	if (!Resources.Contains(ResourceType))
-		return false;
-
-	return Resources[ResourceType] >= Quantity;
+	int32 CurrentQuantity = Resources.Get(ResourceType);
+	return CurrentQuantity > 0 && CurrentQuantity >= Quantity;
 }
 
 int32 UInventoryComponent::GetResourceQuantity(EResourceType ResourceType) const
 {
-	if (Resources.Contains(ResourceType))
-	{
-		return Resources[ResourceType];
-	}
-
-	return 0;
+	return Resources.Get(ResourceType);
 }
 
 TArray<FResourceStack> UInventoryComponent::GetAllResources() const
 {
-	TArray<FResourceStack> Result;
-
-	for (const auto& Pair : Resources)
-	{
-		if (Pair.Value > 0)
-		{
-			Result.Add(FResourceStack(Pair.Key, Pair.Value));
-		}
-	}
-
-	return Result;
+	return Resources.ToStacks();
 }
 
 void UInventoryComponent::ClearInventory()
 {
-	Resources.Empty();
+	FResourceVector Cleared = Resources;
+	Resources.Reset();
+	++Version;
+
+	for (const FResourceStack& Stack : Cleared)
+	{
+		OnResourceChanged.Broadcast(this, Stack.ResourceType, -Stack.Quantity);
+	}
+
 	UE_LOG(LogTemp, Log, TEXT("%s: Inventory cleared"), *GetOwner()->GetName());
 }
 
 int32 UInventoryComponent::GetTotalItems() const
 {
-	int32 Total = 0;
-
-	for (const auto& Pair : Resources)
-	{
-		Total += Pair.Value;
-	}
-
-	return Total;
+	return Resources.GetTotal();
 }
 
 bool UInventoryComponent::IsFull() const
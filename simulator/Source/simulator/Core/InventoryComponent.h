@@ -7,6 +7,11 @@
 #include "SimulatorTypes.h"
 #include "InventoryComponent.generated.h"
 
+class UInventoryComponent;
+
+// Signed quantity change of one resource type, broadcast after the change
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnInventoryResourceChanged, UInventoryComponent* /*Inventory*/, EResourceType /*ResourceType*/, int32 /*Delta*/);
+
 /**
  * Component for managing resource inventory
  * Can be attached to Villagers, Buildings, or Storage
@@ -36,10 +41,16 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Inventory")
 	int32 GetResourceQuantity(EResourceType ResourceType) const;
 
-	// Get all resources in inventory
+	// Get all resources in inventory (allocates - C++ callers should iterate GetResources instead)
 	UFUNCTION(BlueprintCallable, Category = "Inventory")
 	TArray<FResourceStack> GetAllResources() const;
 
+	// Read-only view of the contents; range-for yields each non-zero stack without copying
+	const FResourceVector& GetResources() const { return Resources; }
+
+	// Bumped on every change - compare with a saved value to skip work on unchanged inventories
+	uint32 GetVersion() const { return Version; }
+
 	// Clear all resources
 	UFUNCTION(BlueprintCallable, Category = "Inventory")
 	void ClearInventory();
@@ -61,8 +72,14 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Inventory")
 	int32 MaxCapacity;
 
+	// Quantity changes, for listeners keeping running totals (e.g. UResourceManagerSubsystem)
+	FOnInventoryResourceChanged OnResourceChanged;
+
 protected:
-	// Resource storage (ResourceType -> Quantity)
+	// Resource storage (quantity per ResourceType, total cached)
 	UPROPERTY()
-	TMap<EResourceType, int32> Resources;
+	FResourceVector Resources;
+
+	// Change counter (see GetVersion)
+	uint32 Version = 0;
 };
@@ -0,0 +1,28 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ResourceVectorLibrary.h"
+
+int32 UResourceVectorLibrary::GetResourceAmount(const FResourceVector& Resources, EResourceType ResourceType)
+{
+	return Resources.Get(ResourceType);
+}
+
+void UResourceVectorLibrary::SetResourceAmount(FResourceVector& Resources, EResourceType ResourceType, int32 Amount)
+{
+	Resources.Set(ResourceType, Amount);
+}
+
+int32 UResourceVectorLibrary::GetResourceTotal(const FResourceVector& Resources)
+{
+	return Resources.GetTotal();
+}
+
+FResourceVector UResourceVectorLibrary::MakeResourceVector(const TArray<FResourceStack>& Stacks)
+{
+	return FResourceVector::FromStacks(Stacks);
+}
+
+TArray<FResourceStack> UResourceVectorLibrary::GetResourceStacks(const FResourceVector& Resources)
+{
+	return Resources.ToStacks();
+}
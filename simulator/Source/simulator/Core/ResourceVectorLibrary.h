@@ -0,0 +1,38 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "SimulatorTypes.h"
+#include "ResourceVectorLibrary.generated.h"
+
+/**
+ * Blueprint access to FResourceVector
+ */
+UCLASS()
+class SIMULATOR_API UResourceVectorLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	// Quantity of one resource type
+	UFUNCTION(BlueprintPure, Category = "Resource")
+	static int32 GetResourceAmount(const FResourceVector& Resources, EResourceType ResourceType);
+
+	// Set the quantity of one resource type
+	UFUNCTION(BlueprintCallable, Category = "Resource")
+	static void SetResourceAmount(UPARAM(ref) FResourceVector& Resources, EResourceType ResourceType, int32 Amount);
+
+	// Sum of all resource types
+	UFUNCTION(BlueprintPure, Category = "Resource")
+	static int32 GetResourceTotal(const FResourceVector& Resources);
+
+	// Build a vector from stacks (repeated types add up)
+	UFUNCTION(BlueprintPure, Category = "Resource")
+	static FResourceVector MakeResourceVector(const TArray<FResourceStack>& Stacks);
+
+	// Non-zero entries as stacks
+	UFUNCTION(BlueprintPure, Category = "Resource")
+	static TArray<FResourceStack> GetResourceStacks(const FResourceVector& Resources);
+};
@@ -0,0 +1,26 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "SimRandomStream.h"
+#include "Hash/CityHash.h"
+
+FSimRandomStream::FSimRandomStream(int32 Seed, const FString& StreamName)
+	: Key(FSimRandomStream(static_cast<uint32>(Seed)).Fork(HashStreamName(StreamName)).GetKey())
+{
+}
+
+int32 FSimRandomStream::RandRange(int32 Min, int32 Max)
+{
+	const int64 Range = static_cast<int64>(Max) - Min + 1;
+	if (Range <= 1)
+		return Min;
+
+	// Multiply-shift maps 32 random bits onto the range without a modulo
+	return static_cast<int32>(Min + ((static_cast<uint64>(GetUnsignedInt()) * static_cast<uint64>(Range)) >> 32));
+}
+
+uint64 FSimRandomStream::HashStreamName(const FString& StreamName)
+{
+	// Hash UTF-8 bytes so the id does not depend on TCHAR width
+	const FTCHARToUTF8 Utf8(*StreamName);
+	return CityHash64(Utf8.Get(), Utf8.Length());
+}
@@ -0,0 +1,79 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Counter-based random stream for simulation code
+ * Every draw is a hash of (stream key, draw counter), so a stream's output
+ * depends only on its key and how many values it has produced - not on
+ * which thread runs it or what other streams did in between.
+ *
+ * - Keys are derived from the world seed plus a stable stream name
+ * - Fork() derives independent child streams (e.g. one per grid row or task)
+ */
+struct SIMULATOR_API FSimRandomStream
+{
+	FSimRandomStream() = default;
+
+	explicit FSimRandomStream(uint64 InKey)
+		: Key(InKey)
+	{}
+
+	// Stream for a named purpose under a seed
+	FSimRandomStream(int32 Seed, const FString& StreamName);
+
+	// Uniform 32-bit value
+	uint32 GetUnsignedInt()
+	{
+		return static_cast<uint32>(MixBits(Key + Counter++ * 0x9E3779B97F4A7C15ull) >> 32);
+	}
+
+	// Uniform float in [0, 1)
+	float FRand()
+	{
+		return (GetUnsignedInt() >> 8) * (1.0f / 16777216.0f);
+	}
+
+	// Uniform float in [Min, Max)
+	float FRandRange(float Min, float Max)
+	{
+		return Min + (Max - Min) * FRand();
+	}
+
+	// Uniform integer in [Min, Max] (inclusive, like FMath::RandRange)
+	int32 RandRange(int32 Min, int32 Max);
+
+	bool RandBool()
+	{
+		return (GetUnsignedInt() & 1) != 0;
+	}
+
+	// Independent child stream
+	FSimRandomStream Fork(uint64 SubStreamId) const
+	{
+		return FSimRandomStream(MixBits(Key ^ MixBits(SubStreamId + 0x632BE59BD9B4E019ull)));
+	}
+
+	uint64 GetKey() const { return Key; }
+
+	// Number of values drawn so far (restore with SetCounter to replay)
+	uint64 GetCounter() const { return Counter; }
+	void SetCounter(uint64 InCounter) { Counter = InCounter; }
+
+	// Stable 64-bit id for a stream name (same on every platform and run)
+	static uint64 HashStreamName(const FString& StreamName);
+
+private:
+	// SplitMix64 finalizer
+	static uint64 MixBits(uint64 Value)
+	{
+		Value = (Value ^ (Value >> 30)) * 0xBF58476D1CE4E5B9ull;
+		Value = (Value ^ (Value >> 27)) * 0x94D049BB133111EBull;
+		return Value ^ (Value >> 31);
+	}
+
+	uint64 Key = 0;
+	uint64 Counter = 0;
+};
@@ -0,0 +1,254 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "SimTrace.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Trace/Trace.inl"
+
+UE_TRACE_CHANNEL_DEFINE(SimChannel)
+
+UE_TRACE_EVENT_BEGIN(Sim, Event)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, ObjectId)
+	UE_TRACE_EVENT_FIELD(uint16, EventType)
+	UE_TRACE_EVENT_FIELD(uint8, Category)
+	UE_TRACE_EVENT_FIELD(int32, Arg0)
+	UE_TRACE_EVENT_FIELD(int32, Arg1)
+	UE_TRACE_EVENT_FIELD(float, Value)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Sim, ObjectName)
+	UE_TRACE_EVENT_FIELD(uint32, ObjectId)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, Name)
+UE_TRACE_EVENT_END()
+
+std::atomic<uint32> FSimTrace::EnabledCategories(0);
+std::atomic<uint64> FSimTrace::WriteIndex(0);
+TArray<FSimTraceRecord> FSimTrace::Buffer;
+uint64 FSimTrace::BufferMask = 0;
+FRWLock FSimTrace::ObjectIdsLock;
+TMap<FObjectKey, uint32> FSimTrace::ObjectIds;
+TArray<FString> FSimTrace::ObjectNames;
+
+void FSimTrace::Start(uint32 CategoryMask, int32 Capacity)
+{
+	check(IsInGameThread());
+
+	EnabledCategories.store(0);
+
+	const int32 RingSize = static_cast<int32>(FMath::RoundUpToPowerOfTwo(static_cast<uint32>(FMath::Max(Capacity, 1024))));
+	Buffer.SetNumZeroed(RingSize);
+	BufferMask = RingSize - 1;
+	WriteIndex.store(0);
+
+	{
+		FWriteScopeLock WriteLock(ObjectIdsLock);
+		ObjectIds.Reset();
+		ObjectNames.Reset();
+	}
+
+	EnabledCategories.store(CategoryMask);
+
+	UE_LOG(LogTemp, Log, TEXT("SimTrace: Recording (category mask 0x%x, %d records)"), CategoryMask, RingSize);
+}
+
+void FSimTrace::Stop()
+{
+	EnabledCategories.store(0);
+
+	UE_LOG(LogTemp, Log, TEXT("SimTrace: Stopped (%d records buffered)"), GetNumRecords());
+}
+
+void FSimTrace::Record(ESimTraceCategory Category, ESimTraceEvent EventType, const UObject* Object, int32 Arg0, int32 Arg1, float Value)
+{
+	FSimTraceRecord& Slot = Buffer[WriteIndex.fetch_add(1, std::memory_order_relaxed) & BufferMask];
+	Slot.Cycles = FPlatformTime::Cycles64();
+	Slot.ObjectId = Object ? GetObjectId(Object) : MAX_uint32;
+	Slot.EventType = static_cast<uint16>(EventType);
+	Slot.Category = static_cast<uint8>(Category);
+	Slot.Padding = 0;
+	Slot.Arg0 = Arg0;
+	Slot.Arg1 = Arg1;
+	Slot.Value = Value;
+	Slot.Reserved = 0;
+
+	UE_TRACE_LOG(Sim, Event, SimChannel)
+		<< Event.Cycle(Slot.Cycles)
+		<< Event.ObjectId(Slot.ObjectId)
+		<< Event.EventType(Slot.EventType)
+		<< Event.Category(Slot.Category)
+		<< Event.Arg0(Arg0)
+		<< Event.Arg1(Arg1)
+		<< Event.Value(Value);
+}
+
+uint32 FSimTrace::GetObjectId(const UObject* Object)
+{
+	const FObjectKey Key(Object);
+	{
+		FReadScopeLock ReadLock(ObjectIdsLock);
+		if (const uint32* Id = ObjectIds.Find(Key))
+			return *Id;
+	}
+
+	const FString Name = Object->GetName();
+
+	FWriteScopeLock WriteLock(ObjectIdsLock);
+	if (const uint32* Id = ObjectIds.Find(Key))
+		return *Id;
+
+	const uint32 Id = static_cast<uint32>(ObjectNames.Add(Name));
+	ObjectIds.Add(Key, Id);
+
+	UE_TRACE_LOG(Sim, ObjectName, SimChannel, Name.Len() * sizeof(TCHAR))
+		<< ObjectName.ObjectId(Id)
+		<< ObjectName.Name(*Name, Name.Len());
+
+	return Id;
+}
+
+int32 FSimTrace::GetNumRecords()
+{
+	return static_cast<int32>(FMath::Min<uint64>(WriteIndex.load(), Buffer.Num()));
+}
+
+bool FSimTrace::WriteToFile(const FString& FilePath)
+{
+	check(IsInGameThread());
+
+	const int32 NumRecords = GetNumRecords();
+	if (NumRecords == 0)
+		return false;
+
+	// Oldest record first
+	const uint64 EndIndex = WriteIndex.load();
+	const uint64 StartIndex = EndIndex - NumRecords;
+
+	TArray<FSimTraceRecord> Records;
+	Records.Reserve(NumRecords);
+	for (uint64 Index = StartIndex; Index < EndIndex; ++Index)
+	{
+		Records.Add(Buffer[Index & BufferMask]);
+	}
+
+	// Names as captured, for the objects the buffered records still reference
+	TMap<uint32, FString> Names;
+	{
+		FReadScopeLock ReadLock(ObjectIdsLock);
+		for (const FSimTraceRecord& Record : Records)
+		{
+			if (ObjectNames.IsValidIndex(Record.ObjectId) && !Names.Contains(Record.ObjectId))
+			{
+				Names.Add(Record.ObjectId, ObjectNames[Record.ObjectId]);
+			}
+		}
+	}
+
+	FFileHeader Header;
+	Header.CyclesPerSecond = 1.0 / FPlatformTime::GetSecondsPerCycle64();
+	Header.NumRecords = NumRecords;
+	Header.NumNames = Names.Num();
+
+	TArray<uint8> FileBytes;
+	FileBytes.Reserve(sizeof(FFileHeader) + NumRecords * sizeof(FSimTraceRecord) + Names.Num() * 32);
+	FileBytes.Append(reinterpret_cast<const uint8*>(&Header), sizeof(FFileHeader));
+	FileBytes.Append(reinterpret_cast<const uint8*>(Records.GetData()), NumRecords * sizeof(FSimTraceRecord));
+
+	// Name table: ObjectId, UTF-8 byte count (uint16), bytes
+	for (const auto& Pair : Names)
+	{
+		const FTCHARToUTF8 Utf8(*Pair.Value);
+		const uint16 Length = static_cast<uint16>(FMath::Min(Utf8.Length(), static_cast<int32>(MAX_uint16)));
+		FileBytes.Append(reinterpret_cast<const uint8*>(&Pair.Key), sizeof(uint32));
+		FileBytes.Append(reinterpret_cast<const uint8*>(&Length), sizeof(uint16));
+		FileBytes.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Length);
+	}
+
+	if (!FFileHelper::SaveArrayToFile(FileBytes, *FilePath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("SimTrace: Failed to write %s"), *FilePath);
+		return false;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("SimTrace: Wrote %d records (%d objects) to %s"), NumRecords, Names.Num(), *FilePath);
+	return true;
+}
+
+const TCHAR* FSimTrace::GetCategoryName(ESimTraceCategory Category)
+{
+	switch (Category)
+	{
+	case ESimTraceCategory::Actions:	return TEXT("Actions");
+	case ESimTraceCategory::Villagers:	return TEXT("Villagers");
+	case ESimTraceCategory::Inventory:	return TEXT("Inventory");
+	default:							return TEXT("Unknown");
+	}
+}
+
+const TCHAR* FSimTrace::GetEventName(ESimTraceEvent EventType)
+{
+	switch (EventType)
+	{
+	case ESimTraceEvent::ActionRequested:			return TEXT("ActionRequested");
+	case ESimTraceEvent::ActionGranted:				return TEXT("ActionGranted");
+	case ESimTraceEvent::ActionCompleted:			return TEXT("ActionCompleted");
+	case ESimTraceEvent::GrantCycle:				return TEXT("GrantCycle");
+	case ESimTraceEvent::VillagerActionStarted:		return TEXT("VillagerActionStarted");
+	case ESimTraceEvent::VillagerActionCompleted:	return TEXT("VillagerActionCompleted");
+	case ESimTraceEvent::InventoryAdded:			return TEXT("InventoryAdded");
+	case ESimTraceEvent::InventoryRemoved:			return TEXT("InventoryRemoved");
+	default:										return TEXT("Unknown");
+	}
+}
+
+namespace
+{
+	// sim.Trace.Start [Category...] - no arguments = all categories
+	void StartTrace(const TArray<FString>& Args)
+	{
+		uint32 Mask = 0;
+		for (const FString& Arg : Args)
+		{
+			for (uint32 Index = 0; Index < static_cast<uint32>(ESimTraceCategory::Count); ++Index)
+			{
+				if (Arg.Equals(FSimTrace::GetCategoryName(static_cast<ESimTraceCategory>(Index)), ESearchCase::IgnoreCase))
+				{
+					Mask |= 1u << Index;
+				}
+			}
+		}
+
+		FSimTrace::Start(Mask != 0 ? Mask : (1u << static_cast<uint32>(ESimTraceCategory::Count)) - 1);
+	}
+
+	// sim.Trace.Dump [File] - default Saved/Profiling/SimTrace-<time>.simtrace
+	void DumpTrace(const TArray<FString>& Args)
+	{
+		const FString FilePath = Args.Num() > 0
+			? Args[0]
+			: FPaths::ProfilingDir() / FString::Printf(TEXT("SimTrace-%s.simtrace"), *FDateTime::Now().ToString());
+
+		if (!FSimTrace::WriteToFile(FilePath))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("SimTrace: Nothing to dump"));
+		}
+	}
+
+	FAutoConsoleCommand StartTraceCommand(
+		TEXT("sim.Trace.Start"),
+		TEXT("Record simulation events into the trace ring buffer. Usage: sim.Trace.Start [Actions] [Villagers] [Inventory] (default all)"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&StartTrace));
+
+	FAutoConsoleCommand StopTraceCommand(
+		TEXT("sim.Trace.Stop"),
+		TEXT("Stop recording simulation events"),
+		FConsoleCommandDelegate::CreateStatic(&FSimTrace::Stop));
+
+	FAutoConsoleCommand DumpTraceCommand(
+		TEXT("sim.Trace.Dump"),
+		TEXT("Write buffered simulation events to a file. Usage: sim.Trace.Dump [FilePath]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&DumpTrace));
+}
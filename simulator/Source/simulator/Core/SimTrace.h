@@ -0,0 +1,149 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/ScopeRWLock.h"
+#include "UObject/ObjectKey.h"
+#include <atomic>
+
+// Master switch; categories can be compiled out one by one below
+#ifndef SIM_TRACE_ENABLED
+	#define SIM_TRACE_ENABLED !UE_BUILD_SHIPPING
+#endif
+
+#ifndef SIM_TRACE_Actions
+	#define SIM_TRACE_Actions SIM_TRACE_ENABLED
+#endif
+
+#ifndef SIM_TRACE_Villagers
+	#define SIM_TRACE_Villagers SIM_TRACE_ENABLED
+#endif
+
+#ifndef SIM_TRACE_Inventory
+	#define SIM_TRACE_Inventory SIM_TRACE_ENABLED
+#endif
+
+/**
+ * Trace event categories (each can be compiled out with SIM_TRACE_<Category> 0
+ * and toggled at runtime)
+ */
+enum class ESimTraceCategory : uint8
+{
+	Actions,	// Turn manager requests, grants and completions
+	Villagers,	// Villager action state changes
+	Inventory,	// Inventory resource changes
+
+	Count
+};
+
+/**
+ * Trace event types - Arg0/Arg1/Value meaning per type
+ */
+enum class ESimTraceEvent : uint16
+{
+	ActionRequested,	// Arg0 = action type, Arg1 = social class, Value = priority
+	ActionGranted,		// Arg0 = action type, Arg1 = active count, Value = priority
+	ActionCompleted,	// Arg0 = active count
+	GrantCycle,			// Arg0 = granted, Arg1 = pending, Value = slot budget
+	VillagerActionStarted,	// Arg0 = action type, Arg1 = new state
+	VillagerActionCompleted,	// Arg0 = action type
+	InventoryAdded,		// Arg0 = resource type, Arg1 = amount added, Value = new quantity
+	InventoryRemoved,	// Arg0 = resource type, Arg1 = amount removed, Value = remaining quantity
+
+	Count
+};
+
+/**
+ * One trace record (32 bytes, no strings - objects are referenced by a per-capture serial)
+ */
+struct FSimTraceRecord
+{
+	uint64 Cycles;
+
+	// Index into the capture's name table (UObject indices get reused, so they can't name an object later)
+	uint32 ObjectId;
+	uint16 EventType;
+	uint8 Category;
+	uint8 Padding;
+	int32 Arg0;
+	int32 Arg1;
+	float Value;
+	uint32 Reserved;
+};
+
+static_assert(sizeof(FSimTraceRecord) == 32, "Trace records are written to disk as-is");
+
+/**
+ * Binary ring-buffer event tracer for simulation hot paths
+ * Records are fixed-size and string-free, so recording costs a cycle read,
+ * an object id lookup and a 32-byte copy (an object's name is only read the
+ * first time it is seen); a disabled category costs one relaxed atomic load.
+ * The buffer keeps the most recent events and is dumped on demand.
+ *
+ * - Recording: SIM_TRACE(Category, Event, Object, Arg0, Arg1, Value)
+ * - Enabled records are also sent to Unreal Insights on the "Sim" trace
+ *   channel (-trace=default,sim)
+ * - Console: sim.Trace.Start [Category...] / sim.Trace.Stop / sim.Trace.Dump [File]
+ * - File format: FFileHeader, records oldest first, then an
+ *   (ObjectId, name) table with the name each object had when first recorded
+ */
+class SIMULATOR_API FSimTrace
+{
+public:
+	static bool IsCategoryEnabled(ESimTraceCategory Category)
+	{
+		return (EnabledCategories.load(std::memory_order_relaxed) & (1u << static_cast<uint32>(Category))) != 0;
+	}
+
+	// Start recording the given categories (bitmask of 1 << ESimTraceCategory) into a ring of Capacity records
+	static void Start(uint32 CategoryMask, int32 Capacity = 65536);
+
+	// Stop recording (buffer is kept for dumping)
+	static void Stop();
+
+	static void Record(ESimTraceCategory Category, ESimTraceEvent EventType, const UObject* Object, int32 Arg0, int32 Arg1, float Value);
+
+	// Write buffered records to a file (oldest first). Returns false if nothing was written.
+	static bool WriteToFile(const FString& FilePath);
+
+	// Number of records currently buffered
+	static int32 GetNumRecords();
+
+	static const TCHAR* GetCategoryName(ESimTraceCategory Category);
+	static const TCHAR* GetEventName(ESimTraceEvent EventType);
+
+	struct FFileHeader
+	{
+		uint32 Magic = 0x544D4953; // "SIMT"
+		uint32 Version = 2;
+		double CyclesPerSecond = 0.0;
+		uint32 NumRecords = 0;
+		uint32 NumNames = 0;
+	};
+
+private:
+	// Serial for an object in the current capture, recording its name the first time it is seen
+	static uint32 GetObjectId(const UObject* Object);
+
+	static std::atomic<uint32> EnabledCategories;
+	static std::atomic<uint64> WriteIndex;
+
+	// Power-of-two sized ring
+	static TArray<FSimTraceRecord> Buffer;
+	static uint64 BufferMask;
+
+	// Objects seen in the current capture (object keys, so a reused UObject slot gets a new serial)
+	static FRWLock ObjectIdsLock;
+	static TMap<FObjectKey, uint32> ObjectIds;
+	static TArray<FString> ObjectNames;
+};
+
+#define SIM_TRACE(Category, EventType, Object, Arg0, Arg1, Value) \
+	do \
+	{ \
+		if (SIM_TRACE_##Category && FSimTrace::IsCategoryEnabled(ESimTraceCategory::Category)) \
+		{ \
+			FSimTrace::Record(ESimTraceCategory::Category, ESimTraceEvent::EventType, Object, static_cast<int32>(Arg0), static_cast<int32>(Arg1), static_cast<float>(Value)); \
+		} \
+	} while (0)
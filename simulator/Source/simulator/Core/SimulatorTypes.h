@@ -34,6 +34,9 @@ enum class ESocialClass : uint8
 	Lord        UMETA(DisplayName = "Lord")            // Highest priority
 };
 
+// Number of ESocialClass values (update when the enum grows)
+constexpr int32 NumSocialClasses = static_cast<int32>(ESocialClass::Lord) + 1;
+
 /**
  * Skill level for production buildings (medieval guild system)
  * Novice: Can work in Tier 1 buildings (raw material gathering)
@@ -133,6 +136,202 @@ struct FResourceStack
 	{}
 };
 
+// Number of EResourceType values (update when the enum grows)
+constexpr int32 NumResourceTypes = static_cast<int32>(EResourceType::Ale) + 1;
+
+/**
+ * Range-for iterator over the non-zero entries of an FResourceVector
+ */
+struct FResourceVectorIterator
+{
+	FResourceVectorIterator(const int32* InAmounts, int32 InIndex)
+		: Amounts(InAmounts)
+		, Index(InIndex)
+	{
+		SkipZeros();
+	}
+
+	FResourceStack operator*() const { return FResourceStack(static_cast<EResourceType>(Index), Amounts[Index]); }
+	FResourceVectorIterator& operator++() { ++Index; SkipZeros(); return *this; }
+	bool operator!=(const FResourceVectorIterator& Other) const { return Index != Other.Index; }
+
+private:
+	void SkipZeros()
+	{
+		while (Index < NumResourceTypes && Amounts[Index] == 0)
+		{
+			++Index;
+		}
+	}
+
+	const int32* Amounts;
+	int32 Index;
+};
+
+/**
+ * Quantity of every resource type, indexed by EResourceType
+ * Fixed size with no heap allocation. Element-wise math runs over 16 padded
+ * lanes with a fixed trip count so the compiler vectorizes it, and the total
+ * is kept up to date by every mutation.
+ * Iterating yields FResourceStack for each non-zero entry, in enum order.
+ */
+USTRUCT(BlueprintType)
+struct SIMULATOR_API FResourceVector
+{
+	GENERATED_BODY()
+
+	// Lanes including padding (padding lanes stay 0)
+	static constexpr int32 NumLanes = 16;
+	static_assert(NumResourceTypes <= NumLanes, "EResourceType no longer fits in FResourceVector");
+
+	FResourceVector()
+	{
+		Reset();
+	}
+
+	FORCEINLINE int32 Get(EResourceType ResourceType) const { return Amounts[static_cast<int32>(ResourceType)]; }
+	FORCEINLINE int32 operator[](EResourceType ResourceType) const { return Get(ResourceType); }
+
+	// Sum of all entries
+	FORCEINLINE int32 GetTotal() const { return Total; }
+
+	FORCEINLINE void Set(EResourceType ResourceType, int32 Amount)
+	{
+		int32& Slot = Amounts[static_cast<int32>(ResourceType)];
+		Total += Amount - Slot;
+		Slot = Amount;
+	}
+
+	// Add a signed amount, returns the new quantity
+	FORCEINLINE int32 Add(EResourceType ResourceType, int32 Delta)
+	{
+		Total += Delta;
+		return Amounts[static_cast<int32>(ResourceType)] += Delta;
+	}
+
+	void Reset()
+	{
+		FMemory::Memzero(Amounts);
+		Total = 0;
+	}
+
+	// No non-zero entries
+	bool IsEmpty() const
+	{
+		int32 NonZero = 0;
+		for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+		{
+			NonZero |= Amounts[Lane];
+		}
+		return NonZero == 0;
+	}
+
+	// Every entry >= the matching entry of Other
+	bool Covers(const FResourceVector& Other) const
+	{
+		bool bCovers = true;
+		for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+		{
+			bCovers &= Amounts[Lane] >= Other.Amounts[Lane];
+		}
+		return bCovers;
+	}
+
+	FResourceVector& operator+=(const FResourceVector& Other)
+	{
+		for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+		{
+			Amounts[Lane] += Other.Amounts[Lane];
+		}
+		Total += Other.Total;
+		return *this;
+	}
+
+	FResourceVector& operator-=(const FResourceVector& Other)
+	{
+		for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+		{
+			Amounts[Lane] -= Other.Amounts[Lane];
+		}
+		Total -= Other.Total;
+		return *this;
+	}
+
+	FResourceVector operator+(const FResourceVector& Other) const { FResourceVector Result = *this; return Result += Other; }
+	FResourceVector operator-(const FResourceVector& Other) const { FResourceVector Result = *this; return Result -= Other; }
+
+	bool operator==(const FResourceVector& Other) const
+	{
+		return FMemory::Memcmp(Amounts, Other.Amounts, sizeof(Amounts)) == 0;
+	}
+	bool operator!=(const FResourceVector& Other) const { return !(*this == Other); }
+
+	static FResourceVector Min(const FResourceVector& A, const FResourceVector& B)
+	{
+		FResourceVector Result;
+		for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+		{
+			Result.Amounts[Lane] = FMath::Min(A.Amounts[Lane], B.Amounts[Lane]);
+		}
+		Result.RecomputeTotal();
+		return Result;
+	}
+
+	static FResourceVector Max(const FResourceVector& A, const FResourceVector& B)
+	{
+		FResourceVector Result;
+		for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+		{
+			Result.Amounts[Lane] = FMath::Max(A.Amounts[Lane], B.Amounts[Lane]);
+		}
+		Result.RecomputeTotal();
+		return Result;
+	}
+
+	// Sum stacks per type (repeated types add up)
+	static FResourceVector FromStacks(const TArray<FResourceStack>& Stacks)
+	{
+		FResourceVector Result;
+		for (const FResourceStack& Stack : Stacks)
+		{
+			Result.Add(Stack.ResourceType, Stack.Quantity);
+		}
+		return Result;
+	}
+
+	// Non-zero entries as stacks, in enum order
+	TArray<FResourceStack> ToStacks() const
+	{
+		TArray<FResourceStack> Result;
+		for (const FResourceStack& Stack : *this)
+		{
+			Result.Add(Stack);
+		}
+		return Result;
+	}
+
+	FResourceVectorIterator begin() const { return FResourceVectorIterator(Amounts, 0); }
+	FResourceVectorIterator end() const { return FResourceVectorIterator(Amounts, NumResourceTypes); }
+
+private:
+	void RecomputeTotal()
+	{
+		Total = 0;
+		for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+		{
+			Total += Amounts[Lane];
+		}
+	}
+
+	// Quantity per EResourceType (lanes past NumResourceTypes are padding)
+	UPROPERTY()
+	int32 Amounts[16];
+
+	// Cached sum of Amounts
+	UPROPERTY()
+	int32 Total = 0;
+};
+
 /**
  * Construction cost for buildings
  * Defines resources and labor required to construct a building
@@ -229,6 +428,24 @@ enum class EBuildingType : uint8
 	Landmark        UMETA(DisplayName = "Landmark")        // Territory ownership marker
 };
 
+// Number of EBuildingType values (update when the enum grows)
+constexpr int32 NumBuildingTypes = static_cast<int32>(EBuildingType::Landmark) + 1;
+
+// Zone a building type is placed on (raw producers sit on their resource zone, everything else in settlements)
+constexpr ETerrainZone GetZoneForBuildingType(EBuildingType BuildingType)
+{
+	switch (BuildingType)
+	{
+	case EBuildingType::Farm:       return ETerrainZone::Farmland;
+	case EBuildingType::Pasture:    return ETerrainZone::Pasture;
+	case EBuildingType::Lumbercamp: return ETerrainZone::Forest;
+	case EBuildingType::Quarry:     return ETerrainZone::Mountain;
+	case EBuildingType::IronMine:   return ETerrainZone::Mountain;
+	case EBuildingType::FishingHut: return ETerrainZone::Water;
+	default:                        return ETerrainZone::Settlement;
+	}
+}
+
 /**
  * Crafting recipe - defines input and output for resource processing
  */
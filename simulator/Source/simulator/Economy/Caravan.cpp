@@ -4,6 +4,9 @@
 #include "TradingPost.h"
 #include "MilitaryUnit.h"
 #include "CombatEncounter.h"
+#include "ZoneManagerSubsystem.h"
+#include "ZoneGrid.h"
+#include "Engine/World.h"
 
 ACaravan::ACaravan()
 {
@@ -25,6 +28,8 @@ ACaravan::ACaravan()
 	// 이동
 	MovementSpeed = 300.0f; // Unreal units/sec
 	TravelProgress = 0.0f;
+	CurrentWaypointIndex = 0;
+	TotalPathDistance = 0.0f;
 
 	// 전투
 	bIsInCombat = false;
@@ -68,12 +73,7 @@ void ACaravan::Tick(float DeltaTime)
 
 int32 ACaravan::GetCurrentCargoAmount() const
 {
-	int32 Total = 0;
-	for (const auto& Pair : CargoResources)
-	{
-		Total += Pair.Value;
-	}
-	return Total;
+	return CargoResources.GetTotal();
 }
 
 bool ACaravan::AddCargo(EResourceType ResourceType, int32 Amount)
@@ -87,36 +87,26 @@ bool ACaravan::AddCargo(EResourceType ResourceType, int32 Amount)
 		return false;
 	}
 
-	if (!CargoResources.Contains(ResourceType))
-	{
-		CargoResources.Add(ResourceType, 0);
-	}
-
-	CargoResources[ResourceType] += Amount;
+	CargoResources.Add(ResourceType, Amount);
 	return true;
 }
 
 bool ACaravan::RemoveCargo(EResourceType ResourceType, int32 Amount)
 {
-	if (!CargoResources.Contains(ResourceType) || CargoResources[ResourceType] < Amount)
+	int32 CurrentAmount = CargoResources.Get(ResourceType);
+	if (CurrentAmount <= 0 || CurrentAmount < Amount)
 	{
 		return false;
 	}
 
-	CargoResources[ResourceType] -= Amount;
-
-	if (CargoResources[ResourceType] == 0)
-	{
-		CargoResources.Remove(ResourceType);
-	}
-
+	CargoResources.Add(ResourceType, -Amount);
 	return true;
 }
 
-TMap<EResourceType, int32> ACaravan::ExtractAllCargo()
+FResourceVector ACaravan::ExtractAllCargo()
 {
-	TMap<EResourceType, int32> ExtractedCargo = CargoResources;
-	CargoResources.Empty();
+	FResourceVector ExtractedCargo = CargoResources;
+	CargoResources.Reset();
 	return ExtractedCargo;
 }
 
@@ -151,34 +141,39 @@ void ACaravan::UpdateMovement(float DeltaTime)
 {
 	if (!DestinationTradingPost) return;
 
-	float Distance = FVector::Dist(CurrentLocation, TargetLocation);
-
-	if (Distance < 50.0f) // 도착 임계값
+	if (!PathWaypoints.IsValidIndex(CurrentWaypointIndex))
 	{
 		ArrivedAtDestination();
 		return;
 	}
 
-	// 이동
-	FVector Direction = (TargetLocation - CurrentLocation).GetSafeNormal();
-	FVector NewLocation = CurrentLocation + (Direction * MovementSpeed * DeltaTime);
+	// 이번 틱 이동 거리만큼 웨이포인트를 따라 전진
+	float StepDistance = MovementSpeed * DeltaTime;
+	FVector NewLocation = CurrentLocation;
+
+	while (PathWaypoints.IsValidIndex(CurrentWaypointIndex))
+	{
+		const FVector& Waypoint = PathWaypoints[CurrentWaypointIndex];
+		const float Distance = FVector::Dist(NewLocation, Waypoint);
+
+		if (Distance > StepDistance)
+		{
+			NewLocation += (Waypoint - NewLocation).GetSafeNormal() * StepDistance;
+			break;
+		}
+
+		NewLocation = Waypoint;
+		StepDistance -= Distance;
+		CurrentWaypointIndex++;
+	}
 
 	CurrentLocation = NewLocation;
 	SetActorLocation(NewLocation);
 
 	// 진행률 업데이트
-	float TotalDistance = FVector::Dist(
-		OriginTradingPost ? OriginTradingPost->GetActorLocation() : GetActorLocation(),
-		TargetLocation
-	);
-
-	if (TotalDistance > 0.0f)
+	if (TotalPathDistance > 0.0f)
 	{
-		float TraveledDistance = FVector::Dist(
-			OriginTradingPost ? OriginTradingPost->GetActorLocation() : GetActorLocation(),
-			CurrentLocation
-		);
-		TravelProgress = FMath::Clamp(TraveledDistance / TotalDistance, 0.0f, 1.0f);
+		TravelProgress = FMath::Clamp(1.0f - GetRemainingPathDistance() / TotalPathDistance, 0.0f, 1.0f);
 	}
 
 	// 호위 부대도 함께 이동
@@ -186,6 +181,41 @@ void ACaravan::UpdateMovement(float DeltaTime)
 	{
 		GuardUnit->SetActorLocation(NewLocation);
 	}
+
+	if (FVector::Dist(CurrentLocation, TargetLocation) < 50.0f) // 도착 임계값
+	{
+		ArrivedAtDestination();
+	}
+}
+
+float ACaravan::GetRemainingPathDistance() const
+{
+	if (!PathWaypoints.IsValidIndex(CurrentWaypointIndex))
+		return 0.0f;
+
+	float Remaining = FVector::Dist(CurrentLocation, PathWaypoints[CurrentWaypointIndex]);
+	for (int32 Index = CurrentWaypointIndex + 1; Index < PathWaypoints.Num(); Index++)
+	{
+		Remaining += FVector::Dist(PathWaypoints[Index - 1], PathWaypoints[Index]);
+	}
+	return Remaining;
+}
+
+void ACaravan::BuildPathToTarget()
+{
+	PathWaypoints.Reset();
+	CurrentWaypointIndex = 0;
+
+	// 물/산 등 통행 불가 지형을 우회하는 경로
+	UZoneManagerSubsystem* ZoneManager = GetWorld() ? GetWorld()->GetSubsystem<UZoneManagerSubsystem>() : nullptr;
+	AZoneGrid* ZoneGrid = ZoneManager ? ZoneManager->GetZoneGrid() : nullptr;
+	if (!ZoneGrid || !ZoneGrid->FindPath(CurrentLocation, TargetLocation, PathWaypoints))
+	{
+		PathWaypoints.Reset();
+		PathWaypoints.Add(TargetLocation);
+	}
+
+	TotalPathDistance = GetRemainingPathDistance();
 }
 
 void ACaravan::EnterCombat(ACombatEncounter* Combat)
@@ -234,34 +264,26 @@ void ACaravan::LeaveCombat(bool bVictory)
 	}
 }
 
-TMap<EResourceType, int32> ACaravan::GetLooted(float LootPercentage)
+FResourceVector ACaravan::GetLooted(float LootPercentage)
 {
-	TMap<EResourceType, int32> LootedResources;
+	FResourceVector LootedResources;
 
 	LootPercentage = FMath::Clamp(LootPercentage, 0.0f, 1.0f);
 
-	for (auto& Pair : CargoResources)
+	for (const FResourceStack& Stack : CargoResources)
 	{
-		int32 LootAmount = FMath::RoundToInt(Pair.Value * LootPercentage);
+		int32 LootAmount = FMath::RoundToInt(Stack.Quantity * LootPercentage);
 
 		if (LootAmount > 0)
 		{
-			LootedResources.Add(Pair.Key, LootAmount);
-			Pair.Value -= LootAmount;
+			LootedResources.Set(Stack.ResourceType, LootAmount);
 
 			UE_LOG(LogTemp, Warning, TEXT("Caravan lost %d %s to looters"),
-				LootAmount, *UEnum::GetValueAsString(Pair.Key));
+				LootAmount, *UEnum::GetValueAsString(Stack.ResourceType));
 		}
 	}
 
-	// 0이 된 자원 제거
-	for (auto It = CargoResources.CreateIterator(); It; ++It)
-	{
-		if (It.Value() <= 0)
-		{
-			It.RemoveCurrent();
-		}
-	}
+	CargoResources -= LootedResources;
 
 	return LootedResources;
 }
@@ -269,7 +291,7 @@ TMap<EResourceType, int32> ACaravan::GetLooted(float LootPercentage)
 void ACaravan::InitializeCaravan(
 	ATradingPost* Origin,
 	ATradingPost* Destination,
-	TMap<EResourceType, int32> Resources,
+	const FResourceVector& Resources,
 	int32 Guards)
 {
 	OriginTradingPost = Origin;
@@ -300,10 +322,12 @@ void ACaravan::StartJourney()
 	CaravanState = ECaravanState::Traveling;
 	TargetLocation = DestinationTradingPost->GetActorLocation();
 	TravelProgress = 0.0f;
+	BuildPathToTarget();
 
-	UE_LOG(LogTemp, Log, TEXT("Caravan started journey to %s (distance: %.0f units)"),
+	UE_LOG(LogTemp, Log, TEXT("Caravan started journey to %s (distance: %.0f units, %d waypoints)"),
 		*DestinationTradingPost->TerritoryName,
-		FVector::Dist(CurrentLocation, TargetLocation));
+		TotalPathDistance,
+		PathWaypoints.Num());
 }
 
 void ACaravan::ArrivedAtDestination()
@@ -336,7 +360,7 @@ void ACaravan::DestroyCaravan()
 	ReleaseGuardUnit();
 
 	// 남은 화물 제거
-	CargoResources.Empty();
+	CargoResources.Reset();
 
 	// 액터 제거
 	SetLifeSpan(1.0f);
@@ -346,8 +370,7 @@ float ACaravan::GetEstimatedArrivalTime() const
 {
 	if (!DestinationTradingPost || MovementSpeed <= 0.0f) return -1.0f;
 
-	float RemainingDistance = FVector::Dist(CurrentLocation, TargetLocation);
-	return RemainingDistance / MovementSpeed;
+	return GetRemainingPathDistance() / MovementSpeed;
 }
 
 int32 ACaravan::GetTotalCargoValue() const
@@ -62,7 +62,7 @@ public:
 
 	// 운반 중인 자원
 	UPROPERTY(BlueprintReadOnly, Category = "Caravan|Cargo")
-	TMap<EResourceType, int32> CargoResources;
+	FResourceVector CargoResources;
 
 	// 최대 적재량
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Caravan|Cargo")
@@ -82,7 +82,7 @@ public:
 
 	// 모든 화물 인출 (약탈용)
 	UFUNCTION(BlueprintCallable, Category = "Caravan|Cargo")
-	TMap<EResourceType, int32> ExtractAllCargo();
+	FResourceVector ExtractAllCargo();
 
 	// === Guards (호위 병력) ===
 
@@ -120,9 +120,30 @@ public:
 	UPROPERTY(BlueprintReadOnly, Category = "Caravan|Movement")
 	float TravelProgress;
 
+	// 경로 웨이포인트 (ZoneGrid 경로 탐색 결과, 마지막 = TargetLocation)
+	UPROPERTY(BlueprintReadOnly, Category = "Caravan|Movement")
+	TArray<FVector> PathWaypoints;
+
+	// 현재 향하는 웨이포인트 인덱스
+	UPROPERTY(BlueprintReadOnly, Category = "Caravan|Movement")
+	int32 CurrentWaypointIndex;
+
 	// 이동 업데이트
 	void UpdateMovement(float DeltaTime);
 
+	// 남은 경로 거리
+	UFUNCTION(BlueprintCallable, Category = "Caravan|Movement")
+	float GetRemainingPathDistance() const;
+
+protected:
+	// 출발 시 전체 경로 길이 (진행률 계산용)
+	float TotalPathDistance;
+
+	// 목표까지 경로 계산 (ZoneGrid가 없거나 경로가 없으면 직선)
+	void BuildPathToTarget();
+
+public:
+
 	// === Combat ===
 
 	// 전투 중인지 여부
@@ -143,7 +164,7 @@ public:
 
 	// 약탈당함 (전투 패배 시)
 	UFUNCTION(BlueprintCallable, Category = "Caravan|Combat")
-	TMap<EResourceType, int32> GetLooted(float LootPercentage = 0.5f);
+	FResourceVector GetLooted(float LootPercentage = 0.5f);
 
 	// === Initialization ===
 
@@ -152,7 +173,7 @@ public:
 	void InitializeCaravan(
 		class ATradingPost* Origin,
 		class ATradingPost* Destination,
-		TMap<EResourceType, int32> Resources,
+		const FResourceVector& Resources,
 		int32 Guards = 0
 	);
 
@@ -4,6 +4,7 @@
 #include "Citizen.h"
 #include "Guard.h"
 #include "Merchant.h"
+#include "SimulationRandomSubsystem.h"
 #include "NavigationSystem.h"
 #include "Kismet/GameplayStatics.h"
 #include "GameFramework/PlayerStart.h"
@@ -127,7 +128,8 @@ FVector AVillageGameMode::GetRandomSpawnLocation()
 	}
 
 	// Fallback to random location around origin
-	float RandomX = FMath::RandRange(-SpawnRadius, SpawnRadius);
-	float RandomY = FMath::RandRange(-SpawnRadius, SpawnRadius);
+	FSimRandomStream& RandomStream = USimulationRandomSubsystem::GetWorldStream(this, TEXT("Spawning"));
+	float RandomX = RandomStream.FRandRange(-SpawnRadius, SpawnRadius);
+	float RandomY = RandomStream.FRandRange(-SpawnRadius, SpawnRadius);
 	return Origin + FVector(RandomX, RandomY, 0.0f);
 }
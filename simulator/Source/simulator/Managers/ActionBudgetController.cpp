@@ -0,0 +1,102 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ActionBudgetController.h"
+#include "TurnManagerSubsystem.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+
+namespace
+{
+	// Weight of the newest cycle in the moving averages
+	constexpr float SmoothingAlpha = 0.3f;
+
+	// Fraction of the current budget slots may grow or shrink by per cycle
+	constexpr float MaxStepFraction = 0.25f;
+
+	// Share of an overrun villager actions must account for before slots are shed
+	// (otherwise the overrun comes from elsewhere and fewer actions won't fix it)
+	constexpr float MinActionShareOfOverrun = 0.25f;
+
+	float Smooth(float Average, float Sample)
+	{
+		return Average > 0.0f ? FMath::Lerp(Average, Sample, SmoothingAlpha) : Sample;
+	}
+}
+
+void FActionBudgetController::Reset(int32 InitialSlots, float InitialInterval)
+{
+	Slots = FMath::Clamp(static_cast<float>(InitialSlots), static_cast<float>(MinSlots), static_cast<float>(MaxSlots));
+	Interval = FMath::Clamp(InitialInterval, MinInterval, MaxInterval);
+	FrameMs = 0.0f;
+	ActionMs = 0.0f;
+	CostPerActionMs = 0.0f;
+	CycleFrameSeconds = 0.0;
+	CycleActionSeconds = 0.0;
+	CycleFrames = 0;
+}
+
+void FActionBudgetController::AddFrame(float FrameSeconds)
+{
+	CycleFrameSeconds += FrameSeconds;
+	CycleFrames++;
+}
+
+void FActionBudgetController::Update(int32 ActiveCount, int32 PendingCount)
+{
+	if (CycleFrames == 0)
+		return;
+
+	// Per-frame averages of this cycle
+	FrameMs = Smooth(FrameMs, static_cast<float>(CycleFrameSeconds * 1000.0 / CycleFrames));
+	ActionMs = Smooth(ActionMs, static_cast<float>(CycleActionSeconds * 1000.0 / CycleFrames));
+	if (ActiveCount > 0)
+	{
+		CostPerActionMs = Smooth(CostPerActionMs, ActionMs / ActiveCount);
+	}
+
+	CycleFrameSeconds = 0.0;
+	CycleActionSeconds = 0.0;
+	CycleFrames = 0;
+
+	const float MaxStep = FMath::Max(1.0f, Slots * MaxStepFraction);
+	const float BudgetMs = GetBudgetMs();
+
+	if (FrameMs > BudgetMs)
+	{
+		// Over budget: shed the actions that cost more than the overshoot, grant less often.
+		// Only when actions are measurably part of the overrun - with no measured cost there
+		// is nothing to size the cut by, and shedding would not bring the frame down.
+		const float OverrunMs = FrameMs - BudgetMs;
+		if (CostPerActionMs > 0.0f && ActionMs >= OverrunMs * MinActionShareOfOverrun)
+		{
+			Slots -= FMath::Clamp(OverrunMs / CostPerActionMs, 1.0f, MaxStep);
+			Interval *= 1.25f;
+		}
+	}
+	else if (PendingCount > 0 && ActiveCount >= GetSlots())
+	{
+		// Demand is capped by the budget: fill the remaining frame time
+		const float BaselineMs = FMath::Max(FrameMs - ActionMs, 0.0f);
+		const float Affordable = CostPerActionMs > 0.0f ? (BudgetMs - BaselineMs) / CostPerActionMs : Slots + MaxStep;
+		Slots += FMath::Clamp(Affordable - Slots, 0.0f, MaxStep);
+		Interval *= 0.8f;
+	}
+
+	Slots = FMath::Clamp(Slots, static_cast<float>(MinSlots), static_cast<float>(MaxSlots));
+	Interval = FMath::Clamp(Interval, MinInterval, MaxInterval);
+}
+
+FScopedActionCost::FScopedActionCost(const UObject* WorldContextObject)
+	: WorldContext(WorldContextObject)
+	, StartTime(FPlatformTime::Seconds())
+{
+}
+
+FScopedActionCost::~FScopedActionCost()
+{
+	const UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+	if (UTurnManagerSubsystem* TurnManager = World ? World->GetSubsystem<UTurnManagerSubsystem>() : nullptr)
+	{
+		TurnManager->ReportActionCost(FPlatformTime::Seconds() - StartTime);
+	}
+}
@@ -0,0 +1,89 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Adaptive action slot budget
+ * Once per grant cycle it compares the average game thread time against a
+ * target and sizes the number of simultaneous villager actions (and how often
+ * new ones are granted) to fit.
+ *
+ * - Frames are measured as game thread work, not wall-clock delta time, so
+ *   time spent waiting on vsync or the frame rate limiter never counts
+ * - Work done on behalf of active villagers (grants, steering, ticks) is
+ *   reported through AddActionCost and averaged into a cost per action
+ * - Frame time minus that work is the baseline; the rest of the budget
+ *   (target minus headroom) is what villager actions may use
+ * - Slots move toward that estimate by a bounded step each cycle, and the
+ *   grant interval shortens while there is backlog and headroom. Slots are
+ *   only shed when villager actions are a real share of an overrun.
+ */
+struct SIMULATOR_API FActionBudgetController
+{
+	// Frame time to hold (ms)
+	float TargetFrameMs = 16.0f;
+
+	// Fraction of the target kept free for spikes; actions are sized to the rest
+	float HeadroomFraction = 0.15f;
+
+	// Slot limits
+	int32 MinSlots = 2;
+	int32 MaxSlots = 200;
+
+	// Grant interval limits (seconds)
+	float MinInterval = 0.25f;
+	float MaxInterval = 2.0f;
+
+	// Restart from a fixed budget (measurements are dropped)
+	void Reset(int32 InitialSlots, float InitialInterval);
+
+	// Record one frame's game thread work time
+	void AddFrame(float FrameSeconds);
+
+	// Record time spent on behalf of active villagers this cycle
+	void AddActionCost(double Seconds) { CycleActionSeconds += Seconds; }
+
+	// Close the cycle: update measurements and resize the budget
+	void Update(int32 ActiveCount, int32 PendingCount);
+
+	// Frame time actions are sized to (target minus headroom)
+	float GetBudgetMs() const { return TargetFrameMs * (1.0f - FMath::Clamp(HeadroomFraction, 0.0f, 0.9f)); }
+
+	int32 GetSlots() const { return FMath::RoundToInt(Slots); }
+	float GetInterval() const { return Interval; }
+
+	// Smoothed measurements
+	float GetFrameMs() const { return FrameMs; }
+	float GetActionMs() const { return ActionMs; }
+	float GetCostPerActionMs() const { return CostPerActionMs; }
+
+private:
+	// Current budget (float so small steps accumulate)
+	float Slots = 10.0f;
+	float Interval = 1.0f;
+
+	// Exponential moving averages
+	float FrameMs = 0.0f;
+	float ActionMs = 0.0f;
+	float CostPerActionMs = 0.0f;
+
+	// Accumulators for the open cycle
+	double CycleFrameSeconds = 0.0;
+	double CycleActionSeconds = 0.0;
+	int32 CycleFrames = 0;
+};
+
+/**
+ * Times a scope and reports it to the world's turn manager as action cost
+ */
+struct SIMULATOR_API FScopedActionCost
+{
+	explicit FScopedActionCost(const UObject* WorldContextObject);
+	~FScopedActionCost();
+
+private:
+	const UObject* WorldContext;
+	double StartTime;
+};
@@ -0,0 +1,24 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ActionRequestQueue.h"
+#include "BaseVillager.h"
+#include "UObject/GarbageCollection.h"
+
+bool FActionRequestQueue::Push(const FActionRequest& Request)
+{
+	if (!Request.RequestingActor)
+		return false;
+
+	FActionRequest Keyed = Request;
+	Keyed.RequesterKey = TObjectKey<ABaseVillager>(Request.RequestingActor);
+	return Requests.Push(Keyed);
+}
+
+void FActionRequestQueue::AddStructReferencedObjects(FReferenceCollector& Collector)
+{
+	// GC may null a destroyed requester; its object key still finds the entry for removal
+	for (FActionRequest& Request : Requests.GetRequests())
+	{
+		Collector.AddReferencedObject(Request.RequestingActor);
+	}
+}
@@ -0,0 +1,249 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SimulatorTypes.h"
+#include "UObject/ObjectKey.h"
+#include "ActionRequestQueue.generated.h"
+
+class ABaseVillager;
+
+/**
+ * Action request from an actor
+ */
+USTRUCT(BlueprintType)
+struct FActionRequest
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	class ABaseVillager* RequestingActor;
+
+	UPROPERTY()
+	EActionType ActionType;
+
+	UPROPERTY()
+	ESocialClass SocialClass;
+
+	UPROPERTY()
+	float Priority;
+
+	// Arrival order, breaks priority ties first-come first-served
+	uint32 Sequence;
+
+	// Queue key of the requester (stays usable after GC clears RequestingActor)
+	TObjectKey<ABaseVillager> RequesterKey;
+
+	FActionRequest()
+		: RequestingActor(nullptr)
+		, ActionType(EActionType::None)
+		, SocialClass(ESocialClass::Peasant)
+		, Priority(0.0f)
+		, Sequence(0)
+	{}
+};
+
+/**
+ * Indexed max-heap of pending requests (at most one per requester key)
+ * A side map tracks each key's heap slot, so membership checks are O(1)
+ * and push, pop and removal of an arbitrary requester are O(log n).
+ *
+ * RequestType needs a float Priority, a uint32 Sequence and a RequesterKey of
+ * KeyType (set by the caller before Push). Equal priorities are granted
+ * first-come first-served.
+ */
+template<typename RequestType, typename KeyType>
+class TActionRequestHeap
+{
+public:
+	// Queue a request (false if its requester already has one pending)
+	bool Push(const RequestType& Request)
+	{
+		if (HeapIndices.Contains(Request.RequesterKey))
+			return false;
+
+		RequestType& Added = Heap.Add_GetRef(Request);
+		Added.Sequence = NextSequence++;
+		HeapIndices.Add(Added.RequesterKey, Heap.Num() - 1);
+
+		SiftUp(Heap.Num() - 1);
+		return true;
+	}
+
+	// Take the highest priority request (false if empty)
+	bool Pop(RequestType& OutRequest)
+	{
+		if (Heap.Num() == 0)
+			return false;
+
+		OutRequest = Heap[0];
+		RemoveAt(0);
+		return true;
+	}
+
+	// Drop a requester's pending request (false if it had none)
+	bool Remove(const KeyType& Key)
+	{
+		const int32* Index = HeapIndices.Find(Key);
+		if (!Index)
+			return false;
+
+		RemoveAt(*Index);
+		return true;
+	}
+
+	bool Contains(const KeyType& Key) const { return HeapIndices.Contains(Key); }
+
+	int32 Num() const { return Heap.Num(); }
+
+	// Queued requests in heap order (not sorted)
+	TArrayView<RequestType> GetRequests() { return Heap; }
+
+	void Reserve(int32 Number)
+	{
+		Heap.Reserve(Number);
+		HeapIndices.Reserve(Number);
+	}
+
+	void Empty()
+	{
+		Heap.Empty();
+		HeapIndices.Empty();
+		NextSequence = 0;
+	}
+
+private:
+	// Binary heap, highest priority at index 0
+	TArray<RequestType> Heap;
+
+	// Heap slot of each queued requester
+	TMap<KeyType, int32> HeapIndices;
+
+	// Next arrival sequence number
+	uint32 NextSequence = 0;
+
+	// True if A should be granted before B
+	static bool IsHigherPriority(const RequestType& A, const RequestType& B)
+	{
+		if (A.Priority != B.Priority)
+			return A.Priority > B.Priority;
+
+		return A.Sequence < B.Sequence;
+	}
+
+	// Remove the request in a heap slot
+	void RemoveAt(int32 Index)
+	{
+		HeapIndices.Remove(Heap[Index].RequesterKey);
+
+		const int32 LastIndex = Heap.Num() - 1;
+		if (Index != LastIndex)
+		{
+			// Fill the hole with the last request and restore heap order in whichever direction it breaks
+			Place(Index, Heap[LastIndex]);
+			Heap.Pop(EAllowShrinking::No);
+
+			if (Index > 0 && IsHigherPriority(Heap[Index], Heap[(Index - 1) / 2]))
+			{
+				SiftUp(Index);
+			}
+			else
+			{
+				SiftDown(Index);
+			}
+		}
+		else
+		{
+			Heap.Pop(EAllowShrinking::No);
+		}
+	}
+
+	void SiftUp(int32 Index)
+	{
+		const RequestType Request = Heap[Index];
+		while (Index > 0)
+		{
+			const int32 Parent = (Index - 1) / 2;
+			if (!IsHigherPriority(Request, Heap[Parent]))
+				break;
+
+			Place(Index, Heap[Parent]);
+			Index = Parent;
+		}
+		Place(Index, Request);
+	}
+
+	void SiftDown(int32 Index)
+	{
+		const RequestType Request = Heap[Index];
+		const int32 Count = Heap.Num();
+		while (true)
+		{
+			int32 Child = Index * 2 + 1;
+			if (Child >= Count)
+				break;
+
+			if (Child + 1 < Count && IsHigherPriority(Heap[Child + 1], Heap[Child]))
+			{
+				Child++;
+			}
+
+			if (!IsHigherPriority(Heap[Child], Request))
+				break;
+
+			Place(Index, Heap[Child]);
+			Index = Child;
+		}
+		Place(Index, Request);
+	}
+
+	// Move a request into a slot and record its new index
+	void Place(int32 Index, const RequestType& Request)
+	{
+		Heap[Index] = Request;
+		HeapIndices.FindChecked(Request.RequesterKey) = Index;
+	}
+};
+
+/**
+ * Pending villager action requests (one per actor), keyed by object key so
+ * entries whose actor was destroyed can still be found and removed
+ */
+USTRUCT()
+struct SIMULATOR_API FActionRequestQueue
+{
+	GENERATED_BODY()
+
+	// Queue a request (false if the actor already has one pending)
+	bool Push(const FActionRequest& Request);
+
+	// Take the highest priority request (false if empty)
+	bool Pop(FActionRequest& OutRequest) { return Requests.Pop(OutRequest); }
+
+	// Drop an actor's pending request (false if it had none)
+	bool Remove(const class ABaseVillager* Actor) { return Requests.Remove(TObjectKey<ABaseVillager>(Actor)); }
+
+	bool Contains(const class ABaseVillager* Actor) const { return Requests.Contains(TObjectKey<ABaseVillager>(Actor)); }
+
+	int32 Num() const { return Requests.Num(); }
+
+	void Reserve(int32 Number) { Requests.Reserve(Number); }
+
+	void Empty() { Requests.Empty(); }
+
+	// Keeps the queued requesters referenced for GC
+	void AddStructReferencedObjects(FReferenceCollector& Collector);
+
+private:
+	TActionRequestHeap<FActionRequest, TObjectKey<ABaseVillager>> Requests;
+};
+
+template<>
+struct TStructOpsTypeTraits<FActionRequestQueue> : public TStructOpsTypeTraitsBase2<FActionRequestQueue>
+{
+	enum
+	{
+		WithAddStructReferencedObjects = true,
+	};
+};
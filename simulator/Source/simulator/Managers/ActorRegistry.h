@@ -0,0 +1,296 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Stable reference to an actor in a TActorRegistry
+ * Stays valid while the actor is registered; resolves to nullptr once it is
+ * removed, even if the slot is reused by another actor.
+ */
+struct FActorRegistryHandle
+{
+	int32 Index = INDEX_NONE;
+	uint32 Generation = 0;
+
+	bool IsValid() const { return Index != INDEX_NONE; }
+
+	bool operator==(const FActorRegistryHandle& Other) const { return Index == Other.Index && Generation == Other.Generation; }
+	bool operator!=(const FActorRegistryHandle& Other) const { return !(*this == Other); }
+};
+
+/**
+ * Authoritative set of live actors of one class, fed by the actors' own
+ * BeginPlay/EndPlay instead of world scans.
+ *
+ * Every actor is kept in a dense array plus any number of buckets (e.g. one per
+ * type and one per role), chosen when it is added. Add and Remove are O(1)
+ * (swap-remove, so order is not preserved) and queries return views into
+ * the dense arrays without allocating.
+ *
+ * Pointers are not reported to GC - actors must be removed in EndPlay.
+ */
+template<typename ActorType>
+class TActorRegistry
+{
+public:
+	// Bucket ids are 0..NumBuckets-1. Clears the registry.
+	void SetNumBuckets(int32 NumBuckets)
+	{
+		Reset();
+		Buckets.SetNum(NumBuckets);
+	}
+
+	void Reset()
+	{
+		Slots.Reset();
+		FreeSlots.Reset();
+		All.Reset();
+		AllSlots.Reset();
+		SlotByActor.Reset();
+		for (FBucket& Bucket : Buckets)
+		{
+			Bucket.Actors.Reset();
+			Bucket.Slots.Reset();
+		}
+	}
+
+	// Add an actor to the given buckets (returns the existing handle if already registered)
+	FActorRegistryHandle Add(ActorType* Actor, TConstArrayView<int32> BucketIds = {})
+	{
+		check(Actor);
+
+		if (const int32* ExistingSlot = SlotByActor.Find(Actor))
+		{
+			return MakeHandle(*ExistingSlot);
+		}
+
+		int32 SlotIndex;
+		if (FreeSlots.Num() > 0)
+		{
+			SlotIndex = FreeSlots.Pop(EAllowShrinking::No);
+		}
+		else
+		{
+			SlotIndex = Slots.AddDefaulted();
+		}
+
+		FSlot& Slot = Slots[SlotIndex];
+		Slot.Actor = Actor;
+		Slot.AllPosition = All.Add(Actor);
+		AllSlots.Add(SlotIndex);
+
+		for (const int32 BucketId : BucketIds)
+		{
+			AddToBucket(SlotIndex, BucketId);
+		}
+
+		SlotByActor.Add(Actor, SlotIndex);
+		return MakeHandle(SlotIndex);
+	}
+
+	// Move a registered actor to a different set of buckets, keeping its handle (false if not registered)
+	bool SetBuckets(const ActorType* Actor, TConstArrayView<int32> BucketIds)
+	{
+		const int32* SlotIndex = SlotByActor.Find(Actor);
+		if (!SlotIndex)
+		{
+			return false;
+		}
+
+		while (Slots[*SlotIndex].Memberships.Num() > 0)
+		{
+			RemoveFromBucket(*SlotIndex, Slots[*SlotIndex].Memberships.Last().BucketId);
+		}
+		for (const int32 BucketId : BucketIds)
+		{
+			AddToBucket(*SlotIndex, BucketId);
+		}
+		return true;
+	}
+
+	// Remove an actor from the registry and all of its buckets (false if it wasn't registered)
+	bool Remove(const ActorType* Actor)
+	{
+		int32 SlotIndex;
+		if (!SlotByActor.RemoveAndCopyValue(Actor, SlotIndex))
+		{
+			return false;
+		}
+
+		FSlot& Slot = Slots[SlotIndex];
+
+		// Fill the hole with the last entry and fix up that entry's position
+		const int32 MovedAllSlot = RemoveSwap(All, AllSlots, Slot.AllPosition);
+		if (MovedAllSlot != INDEX_NONE)
+		{
+			Slots[MovedAllSlot].AllPosition = Slot.AllPosition;
+		}
+
+		while (Slot.Memberships.Num() > 0)
+		{
+			RemoveFromBucket(SlotIndex, Slot.Memberships.Last().BucketId);
+		}
+
+		// Outstanding handles to this slot stop resolving
+		Slot.Actor = nullptr;
+		Slot.AllPosition = INDEX_NONE;
+		++Slot.Generation;
+		FreeSlots.Add(SlotIndex);
+
+		return true;
+	}
+
+	bool Contains(const ActorType* Actor) const { return SlotByActor.Contains(Actor); }
+
+	int32 Num() const { return All.Num(); }
+
+	// Handle for a registered actor (invalid handle if not registered)
+	FActorRegistryHandle FindHandle(const ActorType* Actor) const
+	{
+		const int32* SlotIndex = SlotByActor.Find(Actor);
+		return SlotIndex ? MakeHandle(*SlotIndex) : FActorRegistryHandle();
+	}
+
+	// Actor for a handle (nullptr once the actor was removed)
+	ActorType* Resolve(const FActorRegistryHandle& Handle) const
+	{
+		if (!Slots.IsValidIndex(Handle.Index) || Slots[Handle.Index].Generation != Handle.Generation)
+		{
+			return nullptr;
+		}
+		return Slots[Handle.Index].Actor;
+	}
+
+	// Every registered actor (invalidated by Add/Remove)
+	TConstArrayView<ActorType*> GetAll() const { return All; }
+
+	// Actors in one bucket (invalidated by Add/Remove)
+	TConstArrayView<ActorType*> GetBucket(int32 BucketId) const
+	{
+		return Buckets.IsValidIndex(BucketId) ? TConstArrayView<ActorType*>(Buckets[BucketId].Actors) : TConstArrayView<ActorType*>();
+	}
+
+	int32 NumInBucket(int32 BucketId) const
+	{
+		return Buckets.IsValidIndex(BucketId) ? Buckets[BucketId].Actors.Num() : 0;
+	}
+
+	// Compare against the actual set of actors (e.g. from a world scan): actors that never
+	// registered, and registered actors that are gone (compared by address, not dereferenced)
+	void FindDrift(TConstArrayView<ActorType*> ActualActors, TArray<ActorType*>& OutMissing, TArray<ActorType*>& OutStale) const
+	{
+		TSet<const ActorType*> Actual;
+		Actual.Reserve(ActualActors.Num());
+		for (ActorType* Actor : ActualActors)
+		{
+			Actual.Add(Actor);
+			if (!Contains(Actor))
+			{
+				OutMissing.Add(Actor);
+			}
+		}
+
+		for (ActorType* Actor : All)
+		{
+			if (!Actual.Contains(Actor))
+			{
+				OutStale.Add(Actor);
+			}
+		}
+	}
+
+private:
+	struct FMembership
+	{
+		int32 BucketId;
+		int32 Position;
+	};
+
+	struct FSlot
+	{
+		ActorType* Actor = nullptr;
+		uint32 Generation = 0;
+
+		// Position in All
+		int32 AllPosition = INDEX_NONE;
+
+		// Position in each bucket the actor belongs to
+		TArray<FMembership, TInlineAllocator<2>> Memberships;
+
+		FMembership* FindMembership(int32 BucketId)
+		{
+			return Memberships.FindByPredicate([BucketId](const FMembership& Membership) { return Membership.BucketId == BucketId; });
+		}
+	};
+
+	struct FBucket
+	{
+		TArray<ActorType*> Actors;
+
+		// Slot of each entry in Actors
+		TArray<int32> Slots;
+	};
+
+	FActorRegistryHandle MakeHandle(int32 SlotIndex) const
+	{
+		FActorRegistryHandle Handle;
+		Handle.Index = SlotIndex;
+		Handle.Generation = Slots[SlotIndex].Generation;
+		return Handle;
+	}
+
+	void AddToBucket(int32 SlotIndex, int32 BucketId)
+	{
+		FSlot& Slot = Slots[SlotIndex];
+		if (Buckets.IsValidIndex(BucketId) && !Slot.FindMembership(BucketId))
+		{
+			FBucket& Bucket = Buckets[BucketId];
+			Slot.Memberships.Add({ BucketId, Bucket.Actors.Add(Slot.Actor) });
+			Bucket.Slots.Add(SlotIndex);
+		}
+	}
+
+	void RemoveFromBucket(int32 SlotIndex, int32 BucketId)
+	{
+		FSlot& Slot = Slots[SlotIndex];
+		const int32 MembershipIndex = Slot.Memberships.IndexOfByPredicate([BucketId](const FMembership& Membership) { return Membership.BucketId == BucketId; });
+		if (MembershipIndex == INDEX_NONE)
+		{
+			return;
+		}
+
+		const int32 Position = Slot.Memberships[MembershipIndex].Position;
+		Slot.Memberships.RemoveAtSwap(MembershipIndex);
+
+		FBucket& Bucket = Buckets[BucketId];
+		const int32 MovedSlot = RemoveSwap(Bucket.Actors, Bucket.Slots, Position);
+		if (MovedSlot != INDEX_NONE)
+		{
+			Slots[MovedSlot].FindMembership(BucketId)->Position = Position;
+		}
+	}
+
+	// Swap-remove Position from a dense array and its parallel slot array.
+	// Returns the slot that moved into Position (INDEX_NONE if it was the last entry).
+	static int32 RemoveSwap(TArray<ActorType*>& Actors, TArray<int32>& ActorSlots, int32 Position)
+	{
+		const int32 LastPosition = Actors.Num() - 1;
+		const int32 MovedSlot = Position != LastPosition ? ActorSlots[LastPosition] : INDEX_NONE;
+		Actors.RemoveAtSwap(Position, 1, EAllowShrinking::No);
+		ActorSlots.RemoveAtSwap(Position, 1, EAllowShrinking::No);
+		return MovedSlot;
+	}
+
+	TArray<FSlot> Slots;
+	TArray<int32> FreeSlots;
+
+	// Every registered actor and its slot (parallel arrays)
+	TArray<ActorType*> All;
+	TArray<int32> AllSlots;
+
+	TArray<FBucket> Buckets;
+
+	TMap<const ActorType*, int32> SlotByActor;
+};
@@ -4,227 +4,386 @@
 #include "BaseBuilding.h"
 #include "ConstructionSite.h"
 #include "ResourceManagerSubsystem.h"
+#include "ZoneManagerSubsystem.h"
+#include "ZoneGrid.h"
 #include "EngineUtils.h"
-#include "TimerManager.h"
+#include "SimRandomStream.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
 
-void UBuildingManagerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+namespace
 {
-	Super::Initialize(Collection);
+	// Building types that count as storage (see ABaseBuilding::IsStorageBuilding)
+	const EBuildingType StorageBuildingTypes[] = { EBuildingType::Warehouse, EBuildingType::Granary };
+
+	// Nearest/radius query cost of the spatial index vs. a linear scan, with N buildings
+	// spread over a 100x100-cell zone grid (default AZoneGrid size)
+	void BenchmarkBuildingQueries(const TArray<FString>& Args)
+	{
+		TArray<int32> BuildingCounts = { 1000, 10000 };
+		if (Args.Num() > 0)
+		{
+			BuildingCounts.Reset();
+			for (const FString& Arg : Args)
+			{
+				BuildingCounts.Add(FMath::Max(FCString::Atoi(*Arg), 1));
+			}
+		}
+
+		const float CellSize = 5000.0f;
+		const float WorldSize = CellSize * 100.0f;
+		const float QueryRadius = CellSize * 2.0f;
+		const int32 NumQueries = 10000;
+		FSimRandomStream RandomStream(12345, TEXT("BuildingQueryBenchmark"));
+
+		// Buildings are plain ids (1..N, 0 = none) - the index only uses them as keys
+		struct FBenchBuilding
+		{
+			int32 Building;
+			EBuildingType BuildingType;
+			FVector Location;
+		};
 
-	RefreshInterval = 5.0f; // Refresh every 5 seconds
+		auto RandomLocation = [&RandomStream, WorldSize]()
+		{
+			return FVector(RandomStream.FRandRange(0.0f, WorldSize), RandomStream.FRandRange(0.0f, WorldSize), 0.0f);
+		};
+
+		for (const int32 NumBuildings : BuildingCounts)
+		{
+			TArray<FBenchBuilding> Buildings;
+			for (int32 Index = 0; Index < NumBuildings; Index++)
+			{
+				Buildings.Add({
+					Index + 1,
+					static_cast<EBuildingType>(RandomStream.RandRange(0, NumBuildingTypes - 1)),
+					RandomLocation() });
+			}
 
-	// Initial refresh
-	RefreshBuildingList();
-	RefreshConstructionSites();
+			TArray<FVector> QueryLocations;
+			TArray<EBuildingType> QueryTypes;
+			for (int32 Query = 0; Query < NumQueries; Query++)
+			{
+				QueryLocations.Add(RandomLocation());
+				QueryTypes.Add(static_cast<EBuildingType>(RandomStream.RandRange(0, NumBuildingTypes - 1)));
+			}
+
+			TBuildingSpatialIndex<int32> Index;
+			Index.Configure(CellSize, FVector::ZeroVector);
+
+			double StartTime = FPlatformTime::Seconds();
+			for (const FBenchBuilding& Building : Buildings)
+			{
+				Index.Add(Building.Building, Building.BuildingType, Building.Location);
+			}
+			const double BuildSeconds = FPlatformTime::Seconds() - StartTime;
 
-	// Set up periodic refresh
-	if (RefreshInterval > 0.0f && GetWorld())
+			// Nearest of type
+			TArray<int32> IndexNearest;
+			IndexNearest.Reserve(NumQueries);
+			StartTime = FPlatformTime::Seconds();
+			for (int32 Query = 0; Query < NumQueries; Query++)
+			{
+				IndexNearest.Add(Index.FindNearest(QueryLocations[Query], MakeArrayView(&QueryTypes[Query], 1), [](int32) { return true; }));
+			}
+			const double IndexNearestSeconds = FPlatformTime::Seconds() - StartTime;
+
+			TArray<int32> LinearNearest;
+			LinearNearest.Reserve(NumQueries);
+			StartTime = FPlatformTime::Seconds();
+			for (int32 Query = 0; Query < NumQueries; Query++)
+			{
+				int32 Nearest = 0;
+				float NearestDistance = FLT_MAX;
+				for (const FBenchBuilding& Building : Buildings)
+				{
+					if (Building.BuildingType == QueryTypes[Query])
+					{
+						const float Distance = FVector::Dist(QueryLocations[Query], Building.Location);
+						if (Distance < NearestDistance)
+						{
+							NearestDistance = Distance;
+							Nearest = Building.Building;
+						}
+					}
+				}
+				LinearNearest.Add(Nearest);
+			}
+			const double LinearNearestSeconds = FPlatformTime::Seconds() - StartTime;
+
+			// Radius
+			TArray<int32> Found;
+			int32 IndexFound = 0;
+			StartTime = FPlatformTime::Seconds();
+			for (int32 Query = 0; Query < NumQueries; Query++)
+			{
+				Found.Reset();
+				Index.FindWithinRadius(QueryLocations[Query], QueryRadius, Found);
+				IndexFound += Found.Num();
+			}
+			const double IndexRadiusSeconds = FPlatformTime::Seconds() - StartTime;
+
+			int32 LinearFound = 0;
+			const float RadiusSquared = QueryRadius * QueryRadius;
+			StartTime = FPlatformTime::Seconds();
+			for (int32 Query = 0; Query < NumQueries; Query++)
+			{
+				Found.Reset();
+				for (const FBenchBuilding& Building : Buildings)
+				{
+					if (FVector::DistSquared(QueryLocations[Query], Building.Location) <= RadiusSquared)
+					{
+						Found.Add(Building.Building);
+					}
+				}
+				LinearFound += Found.Num();
+			}
+			const double LinearRadiusSeconds = FPlatformTime::Seconds() - StartTime;
+
+			int32 Mismatches = 0;
+			for (int32 Query = 0; Query < NumQueries; Query++)
+			{
+				Mismatches += IndexNearest[Query] != LinearNearest[Query] ? 1 : 0;
+			}
+			Mismatches += IndexFound != LinearFound ? 1 : 0;
+
+			const double ToMicros = 1000000.0 / NumQueries;
+			UE_LOG(LogTemp, Display, TEXT("BuildingQueries %6d buildings: build %.2f ms | nearest %.2f us vs scan %.2f us (x%.1f) | radius %.2f us vs scan %.2f us (x%.1f) | mismatches %d"),
+				NumBuildings, BuildSeconds * 1000.0,
+				IndexNearestSeconds * ToMicros, LinearNearestSeconds * ToMicros, LinearNearestSeconds / FMath::Max(IndexNearestSeconds, 1e-9),
+				IndexRadiusSeconds * ToMicros, LinearRadiusSeconds * ToMicros, LinearRadiusSeconds / FMath::Max(IndexRadiusSeconds, 1e-9),
+				Mismatches);
+		}
+	}
+
+	FAutoConsoleCommand BenchmarkBuildingQueriesCommand(
+		TEXT("sim.BenchmarkBuildingQueries"),
+		TEXT("Measure nearest/radius building query cost. Usage: sim.BenchmarkBuildingQueries [BuildingCount...] (default 1000 10000)"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkBuildingQueries));
+
+	// Every live actor of a class in the world (full scan - resync only)
+	template<typename ActorType>
+	TArray<ActorType*> GatherWorldActors(UWorld* World)
 	{
-		GetWorld()->GetTimerManager().SetTimer(
-			RefreshTimerHandle,
-			this,
-			&UBuildingManagerSubsystem::PeriodicRefresh,
-			RefreshInterval,
-			true
-		);
+		TArray<ActorType*> Actors;
+		for (TActorIterator<ActorType> It(World); It; ++It)
+		{
+			if (IsValid(*It))
+			{
+				Actors.Add(*It);
+			}
+		}
+		return Actors;
 	}
+}
+
+void UBuildingManagerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	// The zone grid (spatial index cells) comes from the zone manager, which also begins play first
+	Collection.InitializeDependency<UZoneManagerSubsystem>();
 
-	UE_LOG(LogTemp, Log, TEXT("BuildingManagerSubsystem initialized with %d buildings, %d construction sites"),
-		AllBuildings.Num(), ConstructionSites.Num());
+	Super::Initialize(Collection);
+
+	// Buildings and construction sites fill the registries from their own BeginPlay
+	Buildings.SetNumBuckets(NumBuildingBuckets);
+	ConstructionSites.Reset();
+	RebuildSpatialIndex();
+
+	UE_LOG(LogTemp, Log, TEXT("BuildingManagerSubsystem initialized"));
 }
 
-void UBuildingManagerSubsystem::Deinitialize()
+void UBuildingManagerSubsystem::OnWorldBeginPlay(UWorld& InWorld)
 {
-	// Clear timer
-	if (GetWorld())
-	{
-		GetWorld()->GetTimerManager().ClearTimer(RefreshTimerHandle);
-	}
+	Super::OnWorldBeginPlay(InWorld);
 
-	AllBuildings.Empty();
-	ConstructionSites.Empty();
+	// The zone grid may not have existed (or been placed) at Initialize - match its cells now
+	RebuildSpatialIndex();
+}
+
+void UBuildingManagerSubsystem::Deinitialize()
+{
+	Buildings.Reset();
+	ConstructionSites.Reset();
+	SpatialIndex.Reset();
 
 	Super::Deinitialize();
 }
 
 void UBuildingManagerSubsystem::RefreshBuildingList()
 {
-	AllBuildings.Empty();
-
 	if (!GetWorld())
 	{
 		return;
 	}
 
-	// Find all buildings in the world
-	for (TActorIterator<ABaseBuilding> It(GetWorld()); It; ++It)
+	TArray<ABaseBuilding*> MissingBuildings;
+	TArray<ABaseBuilding*> StaleBuildings;
+	Buildings.FindDrift(GatherWorldActors<ABaseBuilding>(GetWorld()), MissingBuildings, StaleBuildings);
+
+	for (ABaseBuilding* Building : StaleBuildings)
 	{
-		ABaseBuilding* Building = *It;
-		if (IsValid(Building))
+		Buildings.Remove(Building);
+		SpatialIndex.Remove(Building);
+	}
+	for (ABaseBuilding* Building : MissingBuildings)
+	{
+		RegisterBuilding(Building);
+	}
+
+	TArray<AConstructionSite*> MissingSites;
+	TArray<AConstructionSite*> StaleSites;
+	ConstructionSites.FindDrift(GatherWorldActors<AConstructionSite>(GetWorld()), MissingSites, StaleSites);
+
+	for (AConstructionSite* Site : StaleSites)
+	{
+		ConstructionSites.Remove(Site);
+	}
+	for (AConstructionSite* Site : MissingSites)
+	{
+		if (Site->bIsActive)
 		{
-			AllBuildings.Add(Building);
+			RegisterConstructionSite(Site);
 		}
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("BuildingManagerSubsystem: Found %d buildings"), AllBuildings.Num());
+	RebuildSpatialIndex();
+
+	// Anything found here skipped BeginPlay/EndPlay registration
+	const bool bDrifted = MissingBuildings.Num() + StaleBuildings.Num() + MissingSites.Num() + StaleSites.Num() > 0;
+	UE_LOG(LogTemp, Log, TEXT("BuildingManagerSubsystem: Resynced %d buildings, %d construction sites"),
+		Buildings.Num(), ConstructionSites.Num());
+	UE_CLOG(bDrifted, LogTemp, Warning, TEXT("BuildingManagerSubsystem: Registry was out of sync - buildings %d missing / %d stale, sites %d missing / %d stale"),
+		MissingBuildings.Num(), StaleBuildings.Num(), MissingSites.Num(), StaleSites.Num());
 }
 
-TArray<ABaseBuilding*> UBuildingManagerSubsystem::GetBuildingsByType(EBuildingType BuildingType) const
+void UBuildingManagerSubsystem::RebuildSpatialIndex()
 {
-	TArray<ABaseBuilding*> Result;
+	// Match the zone grid cells when there is one
+	UZoneManagerSubsystem* ZoneManager = GetWorld() ? GetWorld()->GetSubsystem<UZoneManagerSubsystem>() : nullptr;
+	AZoneGrid* ZoneGrid = ZoneManager ? ZoneManager->GetZoneGrid() : nullptr;
+	if (ZoneGrid)
+	{
+		SpatialIndex.Configure(ZoneGrid->CellSize, ZoneGrid->GridOrigin);
+	}
+	else
+	{
+		SpatialIndex.Reset();
+	}
 
-	for (ABaseBuilding* Building : AllBuildings)
+	for (ABaseBuilding* Building : Buildings.GetAll())
 	{
-		if (Building && Building->BuildingType == BuildingType)
-		{
-			Result.Add(Building);
-		}
+		SpatialIndex.Add(Building, Building->BuildingType, Building->GetBuildingLocation());
 	}
+}
 
-	return Result;
+TArray<ABaseBuilding*> UBuildingManagerSubsystem::GetBuildingsByType(EBuildingType BuildingType) const
+{
+	TConstArrayView<ABaseBuilding*> View = GetBuildingsByTypeView(BuildingType);
+	return TArray<ABaseBuilding*>(View.GetData(), View.Num());
 }
 
-ABaseBuilding* UBuildingManagerSubsystem::GetNearestBuilding(FVector Location, EBuildingType BuildingType) const
+TConstArrayView<ABaseBuilding*> UBuildingManagerSubsystem::GetBuildingsByTypeView(EBuildingType BuildingType) const
 {
-	ABaseBuilding* NearestBuilding = nullptr;
-	float NearestDistance = FLT_MAX;
+	return Buildings.GetBucket(static_cast<int32>(BuildingType));
+}
 
-	for (ABaseBuilding* Building : AllBuildings)
+ABaseBuilding* UBuildingManagerSubsystem::GetNearestBuilding(FVector Location, EBuildingType BuildingType) const
+{
+	return SpatialIndex.FindNearest(Location, MakeArrayView(&BuildingType, 1), [](ABaseBuilding* Building)
 	{
-		if (Building && Building->BuildingType == BuildingType)
-		{
-			float Distance = FVector::Dist(Location, Building->GetBuildingLocation());
-			if (Distance < NearestDistance)
-			{
-				NearestDistance = Distance;
-				NearestBuilding = Building;
-			}
-		}
-	}
-
-	return NearestBuilding;
+		return IsValid(Building);
+	});
 }
 
 TArray<ABaseBuilding*> UBuildingManagerSubsystem::GetBuildingsWithinRadius(FVector Location, float Radius) const
 {
 	TArray<ABaseBuilding*> Result;
-	float RadiusSquared = Radius * Radius;
+	SpatialIndex.FindWithinRadius(Location, Radius, Result);
 
-	for (ABaseBuilding* Building : AllBuildings)
-	{
-		if (Building)
-		{
-			float DistanceSquared = FVector::DistSquared(Location, Building->GetBuildingLocation());
-			if (DistanceSquared <= RadiusSquared)
-			{
-				Result.Add(Building);
-			}
-		}
-	}
+	// Pending kill but not yet through EndPlay
+	Result.RemoveAllSwap([](ABaseBuilding* Building) { return !IsValid(Building); });
 
 	return Result;
 }
 
 ABaseBuilding* UBuildingManagerSubsystem::GetNearestStorageBuilding(FVector Location) const
 {
-	ABaseBuilding* NearestStorage = nullptr;
-	float NearestDistance = FLT_MAX;
-
-	for (ABaseBuilding* Building : AllBuildings)
+	return SpatialIndex.FindNearest(Location, StorageBuildingTypes, [](ABaseBuilding* Building)
 	{
-		if (Building && Building->IsStorageBuilding())
-		{
-			float Distance = FVector::Dist(Location, Building->GetBuildingLocation());
-			if (Distance < NearestDistance)
-			{
-				NearestDistance = Distance;
-				NearestStorage = Building;
-			}
-		}
-	}
-
-	return NearestStorage;
+		return IsValid(Building);
+	});
 }
 
 TArray<ABaseBuilding*> UBuildingManagerSubsystem::GetAllStorageBuildings() const
 {
-	TArray<ABaseBuilding*> Result;
-
-	for (ABaseBuilding* Building : AllBuildings)
-	{
-		if (Building && Building->IsStorageBuilding())
-		{
-			Result.Add(Building);
-		}
-	}
-
-	return Result;
+	TConstArrayView<ABaseBuilding*> View = GetStorageBuildingsView();
+	return TArray<ABaseBuilding*>(View.GetData(), View.Num());
 }
 
 ABaseBuilding* UBuildingManagerSubsystem::GetNearestAvailableStorage(FVector Location) const
 {
-	ABaseBuilding* NearestStorage = nullptr;
-	float NearestDistance = FLT_MAX;
-
-	for (ABaseBuilding* Building : AllBuildings)
+	return SpatialIndex.FindNearest(Location, StorageBuildingTypes, [](ABaseBuilding* Building)
 	{
-		if (Building && Building->IsStorageBuilding() && Building->CanAcceptResources())
-		{
-			float Distance = FVector::Dist(Location, Building->GetBuildingLocation());
-			if (Distance < NearestDistance)
-			{
-				NearestDistance = Distance;
-				NearestStorage = Building;
-			}
-		}
-	}
-
-	return NearestStorage;
+		return IsValid(Building) && Building->CanAcceptResources();
+	});
 }
 
 int32 UBuildingManagerSubsystem::GetBuildingCount() const
 {
-	return AllBuildings.Num();
+	return Buildings.Num();
 }
 
 int32 UBuildingManagerSubsystem::GetBuildingCountByType(EBuildingType BuildingType) const
 {
-	int32 Count = 0;
+	return Buildings.NumInBucket(static_cast<int32>(BuildingType));
+}
+
+TArray<ABaseBuilding*> UBuildingManagerSubsystem::GetAllBuildings() const
+{
+	TConstArrayView<ABaseBuilding*> View = GetAllBuildingsView();
+	return TArray<ABaseBuilding*>(View.GetData(), View.Num());
+}
 
-	for (ABaseBuilding* Building : AllBuildings)
+void UBuildingManagerSubsystem::RegisterBuilding(ABaseBuilding* Building)
+{
+	if (Building && !Buildings.Contains(Building))
 	{
-		if (Building && Building->BuildingType == BuildingType)
+		TArray<int32, TInlineAllocator<2>> BucketIds = { static_cast<int32>(Building->BuildingType) };
+		if (Building->IsStorageBuilding())
 		{
-			Count++;
+			BucketIds.Add(StorageBucket);
 		}
-	}
 
-	return Count;
+		Buildings.Add(Building, BucketIds);
+		SpatialIndex.Add(Building, Building->BuildingType, Building->GetBuildingLocation());
+		UE_LOG(LogTemp, Log, TEXT("BuildingManagerSubsystem: Registered building %s (Total: %d)"),
+			*Building->BuildingName, Buildings.Num());
+	}
 }
 
-void UBuildingManagerSubsystem::PeriodicRefresh()
+void UBuildingManagerSubsystem::UnregisterBuilding(ABaseBuilding* Building)
 {
-	RefreshBuildingList();
-	RefreshConstructionSites();
+	if (Building && Buildings.Remove(Building))
+	{
+		SpatialIndex.Remove(Building);
+		UE_LOG(LogTemp, Log, TEXT("BuildingManagerSubsystem: Unregistered building %s (Total: %d)"),
+			*Building->BuildingName, Buildings.Num());
+	}
 }
 
-void UBuildingManagerSubsystem::RegisterBuilding(ABaseBuilding* Building)
+void UBuildingManagerSubsystem::RegisterConstructionSite(AConstructionSite* Site)
 {
-	if (Building && !AllBuildings.Contains(Building))
+	if (Site)
 	{
-		AllBuildings.Add(Building);
-		UE_LOG(LogTemp, Log, TEXT("BuildingManagerSubsystem: Registered building %s (Total: %d)"),
-			*Building->BuildingName, AllBuildings.Num());
+		ConstructionSites.Add(Site);
 	}
 }
 
-void UBuildingManagerSubsystem::UnregisterBuilding(ABaseBuilding* Building)
+void UBuildingManagerSubsystem::UnregisterConstructionSite(AConstructionSite* Site)
 {
-	if (Building)
+	if (Site)
 	{
-		AllBuildings.Remove(Building);
-		UE_LOG(LogTemp, Log, TEXT("BuildingManagerSubsystem: Unregistered building %s (Total: %d)"),
-			*Building->BuildingName, AllBuildings.Num());
+		ConstructionSites.Remove(Site);
 	}
 }
 
@@ -256,6 +415,20 @@ AConstructionSite* UBuildingManagerSubsystem::CreateConstructionSite(
 		return nullptr;
 	}
 
+	// 건물 부지 전체가 요구 구역 위에 있는지 확인 (ZoneGrid가 있을 때만)
+	if (DefaultBuilding->bRequiresZonePlacement)
+	{
+		UZoneManagerSubsystem* ZoneManager = GetWorld()->GetSubsystem<UZoneManagerSubsystem>();
+		AZoneGrid* ZoneGrid = ZoneManager ? ZoneManager->GetZoneGrid() : nullptr;
+		if (ZoneGrid && ZoneGrid->HasCellData() &&
+			!ZoneGrid->CanBuildFootprint(Location, Rotation, DefaultBuilding->FootprintSize, DefaultBuilding->RequiredZoneType))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("BuildingManagerSubsystem: %s footprint at %s is not fully on required zone"),
+				*DefaultBuilding->BuildingName, *Location.ToString());
+			return nullptr;
+		}
+	}
+
 	FConstructionCost Cost = DefaultBuilding->ConstructionCost;
 
 	// 파라미터로 전달된 값이 있으면 오버라이드
@@ -276,8 +449,9 @@ AConstructionSite* UBuildingManagerSubsystem::CreateConstructionSite(
 		return nullptr;
 	}
 
-	// 자원이 충분한지 확인
-	if (!ResourceManager->CanAffordConstruction(Cost))
+	// 자원 예약 (부족하면 아무것도 잡지 않음)
+	FResourceReservationHandle Reservation = ResourceManager->ReserveConstructionCost(Cost);
+	if (!Reservation.IsValid())
 	{
 		UE_LOG(LogTemp, Warning, TEXT("BuildingManagerSubsystem: Not enough resources for %s construction"),
 			*DefaultBuilding->BuildingName);
@@ -285,13 +459,6 @@ AConstructionSite* UBuildingManagerSubsystem::CreateConstructionSite(
 		return nullptr;
 	}
 
-	// 자원 차감
-	if (!ResourceManager->PayConstructionCost(Cost))
-	{
-		UE_LOG(LogTemp, Error, TEXT("BuildingManagerSubsystem: Failed to pay construction cost"));
-		return nullptr;
-	}
-
 	// 건설 현장 스폰
 	FActorSpawnParameters SpawnParams;
 	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
@@ -305,6 +472,14 @@ AConstructionSite* UBuildingManagerSubsystem::CreateConstructionSite(
 
 	if (NewSite)
 	{
+		// 예약 확정 (자원 차감)
+		if (!ResourceManager->CommitReservation(Reservation))
+		{
+			UE_LOG(LogTemp, Error, TEXT("BuildingManagerSubsystem: Failed to pay construction cost"));
+			NewSite->Destroy();
+			return nullptr;
+		}
+
 		// 건설 현장 설정
 		NewSite->BuildingClass = BuildingClass;
 		NewSite->BuildingType = BuildingType;
@@ -313,8 +488,7 @@ AConstructionSite* UBuildingManagerSubsystem::CreateConstructionSite(
 		NewSite->ConstructionLocation = Location;
 		NewSite->BuildingName = FString::Printf(TEXT("%s (Construction)"), *DefaultBuilding->BuildingName);
 
-		// 캐시에 추가
-		ConstructionSites.Add(NewSite);
+		// 등록은 건설 현장의 BeginPlay에서 처리됨
 
 		UE_LOG(LogTemp, Warning, TEXT("BuildingManagerSubsystem: Created construction site for %s at %s (Work: %.0f, Workers: %d)"),
 			*NewSite->BuildingName, *Location.ToString(), Cost.RequiredWorkAmount, Cost.MaxWorkers);
@@ -323,16 +497,17 @@ AConstructionSite* UBuildingManagerSubsystem::CreateConstructionSite(
 	}
 	else
 	{
-		// 건설 현장 스폰 실패 시 자원 반환
-		UE_LOG(LogTemp, Error, TEXT("BuildingManagerSubsystem: Failed to spawn construction site, refunding resources"));
-		ResourceManager->RefundConstructionCost(Cost, Location);
+		// 건설 현장 스폰 실패 시 예약 취소 (차감 전이므로 반환할 자원 없음)
+		UE_LOG(LogTemp, Error, TEXT("BuildingManagerSubsystem: Failed to spawn construction site, releasing reserved resources"));
+		ResourceManager->ReleaseReservation(Reservation);
 		return nullptr;
 	}
 }
 
 TArray<AConstructionSite*> UBuildingManagerSubsystem::GetAllConstructionSites() const
 {
-	return ConstructionSites;
+	TConstArrayView<AConstructionSite*> View = GetConstructionSitesView();
+	return TArray<AConstructionSite*>(View.GetData(), View.Num());
 }
 
 AConstructionSite* UBuildingManagerSubsystem::GetNearestConstructionSite(FVector Location) const
@@ -340,7 +515,7 @@ AConstructionSite* UBuildingManagerSubsystem::GetNearestConstructionSite(FVector
 	AConstructionSite* NearestSite = nullptr;
 	float NearestDistance = FLT_MAX;
 
-	for (AConstructionSite* Site : ConstructionSites)
+	for (AConstructionSite* Site : ConstructionSites.GetAll())
 	{
 		if (Site && Site->bIsActive && Site->HasAvailableWorkerSlots())
 		{
@@ -378,31 +553,9 @@ bool UBuildingManagerSubsystem::CancelConstruction(AConstructionSite* Site)
 		}
 	}
 
-	ConstructionSites.Remove(Site);
+	// 등록 해제는 건설 현장의 EndPlay에서 처리됨
 	Site->Destroy();
 
 	UE_LOG(LogTemp, Warning, TEXT("BuildingManagerSubsystem: Cancelled construction of %s"), *Site->BuildingName);
 	return true;
 }
-
-void UBuildingManagerSubsystem::RefreshConstructionSites()
-{
-	ConstructionSites.Empty();
-
-	if (!GetWorld())
-	{
-		return;
-	}
-
-	// 월드의 모든 건설 현장 찾기
-	for (TActorIterator<AConstructionSite> It(GetWorld()); It; ++It)
-	{
-		AConstructionSite* Site = *It;
-		if (IsValid(Site) && Site->bIsActive)
-		{
-			ConstructionSites.Add(Site);
-		}
-	}
-
-	UE_LOG(LogTemp, Log, TEXT("BuildingManagerSubsystem: Found %d active construction sites"), ConstructionSites.Num());
-}
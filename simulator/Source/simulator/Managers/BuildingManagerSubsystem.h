@@ -5,11 +5,21 @@
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
 #include "SimulatorTypes.h"
+#include "BuildingSpatialIndex.h"
+#include "ActorRegistry.h"
 #include "BuildingManagerSubsystem.generated.h"
 
 /**
  * Manager for all buildings in the world as a WorldSubsystem
  * Provides queries for finding buildings, managing construction, etc.
+ *
+ * Buildings and construction sites register themselves in BeginPlay and
+ * unregister in EndPlay, so the registry is always current without scanning
+ * the world. Buildings are bucketed by type and by role (storage); the
+ * *View accessors return those buckets without allocating.
+ *
+ * Nearest and radius queries go through a per-type spatial grid aligned to
+ * the zone grid cells, kept in sync by RegisterBuilding/UnregisterBuilding.
  */
 UCLASS()
 class SIMULATOR_API UBuildingManagerSubsystem : public UWorldSubsystem
@@ -20,15 +30,19 @@ public:
 	// USubsystem implementation
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 	virtual void Deinitialize() override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
 
-	// Find all buildings in the world
+	// Full resync with the world's buildings and construction sites (debug only - registration keeps the lists current)
 	UFUNCTION(BlueprintCallable, Category = "Building Manager")
 	void RefreshBuildingList();
 
-	// Get all buildings of a specific type
+	// Get all buildings of a specific type (allocates - C++ callers should use GetBuildingsByTypeView)
 	UFUNCTION(BlueprintCallable, Category = "Building Manager")
 	TArray<class ABaseBuilding*> GetBuildingsByType(EBuildingType BuildingType) const;
 
+	// Buildings of a specific type (invalidated when a building registers or unregisters)
+	TConstArrayView<class ABaseBuilding*> GetBuildingsByTypeView(EBuildingType BuildingType) const;
+
 	// Get nearest building of a specific type
 	UFUNCTION(BlueprintCallable, Category = "Building Manager")
 	class ABaseBuilding* GetNearestBuilding(FVector Location, EBuildingType BuildingType) const;
@@ -41,10 +55,13 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Building Manager")
 	class ABaseBuilding* GetNearestStorageBuilding(FVector Location) const;
 
-	// Get all storage buildings
+	// Get all storage buildings (allocates - C++ callers should use GetStorageBuildingsView)
 	UFUNCTION(BlueprintCallable, Category = "Building Manager")
 	TArray<class ABaseBuilding*> GetAllStorageBuildings() const;
 
+	// Storage buildings (invalidated when a building registers or unregisters)
+	TConstArrayView<class ABaseBuilding*> GetStorageBuildingsView() const { return Buildings.GetBucket(StorageBucket); }
+
 	// Get nearest storage building that can accept resources
 	UFUNCTION(BlueprintCallable, Category = "Building Manager")
 	class ABaseBuilding* GetNearestAvailableStorage(FVector Location) const;
@@ -57,18 +74,27 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Building Manager")
 	int32 GetBuildingCountByType(EBuildingType BuildingType) const;
 
-	// Get all buildings
+	// Get all buildings (allocates - C++ callers should use GetAllBuildingsView)
 	UFUNCTION(BlueprintCallable, Category = "Building Manager")
-	TArray<class ABaseBuilding*> GetAllBuildings() const { return AllBuildings; }
+	TArray<class ABaseBuilding*> GetAllBuildings() const;
+
+	// All buildings (invalidated when a building registers or unregisters)
+	TConstArrayView<class ABaseBuilding*> GetAllBuildingsView() const { return Buildings.GetAll(); }
 
-	// Register a new building (called when construction completes or building is spawned)
+	// Register a new building (called from ABaseBuilding::BeginPlay; repeated calls are ignored)
 	UFUNCTION(BlueprintCallable, Category = "Building Manager")
 	void RegisterBuilding(class ABaseBuilding* Building);
 
-	// Unregister a building (called when building is destroyed)
+	// Unregister a building (called from ABaseBuilding::EndPlay)
 	UFUNCTION(BlueprintCallable, Category = "Building Manager")
 	void UnregisterBuilding(class ABaseBuilding* Building);
 
+	// Stable handle for a registered building (invalid if not registered)
+	FActorRegistryHandle GetBuildingHandle(const class ABaseBuilding* Building) const { return Buildings.FindHandle(Building); }
+
+	// Building for a handle (nullptr once it has unregistered)
+	class ABaseBuilding* ResolveBuildingHandle(const FActorRegistryHandle& Handle) const { return Buildings.Resolve(Handle); }
+
 	// === Construction Management ===
 
 	// Create a construction site for a new building
@@ -82,10 +108,19 @@ public:
 		int32 MaxWorkers = 5
 	);
 
-	// Get all active construction sites
+	// Get all active construction sites (allocates - C++ callers should use GetConstructionSitesView)
 	UFUNCTION(BlueprintCallable, Category = "Building Manager|Construction")
 	TArray<class AConstructionSite*> GetAllConstructionSites() const;
 
+	// Construction sites (invalidated when a site registers or unregisters)
+	TConstArrayView<class AConstructionSite*> GetConstructionSitesView() const { return ConstructionSites.GetAll(); }
+
+	// Register a construction site (called from AConstructionSite::BeginPlay)
+	void RegisterConstructionSite(class AConstructionSite* Site);
+
+	// Unregister a construction site (called from AConstructionSite::EndPlay)
+	void UnregisterConstructionSite(class AConstructionSite* Site);
+
 	// Get nearest construction site
 	UFUNCTION(BlueprintCallable, Category = "Building Manager|Construction")
 	class AConstructionSite* GetNearestConstructionSite(FVector Location) const;
@@ -95,23 +130,19 @@ public:
 	bool CancelConstruction(class AConstructionSite* Site);
 
 protected:
-	// Cache of all buildings in the world
-	UPROPERTY()
-	TArray<class ABaseBuilding*> AllBuildings;
-
-	// Cache of all active construction sites
-	UPROPERTY()
-	TArray<class AConstructionSite*> ConstructionSites;
+	// Bucket ids: one per EBuildingType, then role buckets
+	static constexpr int32 StorageBucket = NumBuildingTypes;
+	static constexpr int32 NumBuildingBuckets = StorageBucket + 1;
 
-	// How often to refresh the building list (in seconds)
-	float RefreshInterval;
+	// Every registered building, bucketed by type and role
+	TActorRegistry<class ABaseBuilding> Buildings;
 
-	// Timer for periodic refresh
-	FTimerHandle RefreshTimerHandle;
+	// Every registered construction site
+	TActorRegistry<class AConstructionSite> ConstructionSites;
 
-	// Periodic refresh function
-	void PeriodicRefresh();
+	// Spatial grid over the registered buildings (by type and location)
+	FBuildingSpatialIndex SpatialIndex;
 
-	// Refresh construction sites list
-	void RefreshConstructionSites();
+	// Re-add the registered buildings to the spatial index, using the zone grid's cells if there is one
+	void RebuildSpatialIndex();
 };
@@ -0,0 +1,343 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SimulatorTypes.h"
+
+class ABaseBuilding;
+
+/**
+ * Uniform 2D grid of buildings, one grid per EBuildingType plus one for all types
+ * Cells match the AZoneGrid cells (size and origin) when a zone grid exists.
+ * Nearest queries search rings of cells outward from the query cell and stop
+ * once no unvisited cell can hold anything closer, so cost depends on local
+ * density instead of the building count (see sim.BenchmarkBuildingQueries).
+ *
+ * Elements are opaque keys (building pointers in game, plain ids in the benchmark),
+ * stored by location at insertion (buildings don't move) and never dereferenced -
+ * callers filter out destroyed actors. A default-constructed element means "none".
+ */
+template<typename ElementType>
+class TBuildingSpatialIndex
+{
+public:
+	// Set cell size/origin and clear the index
+	void Configure(float InCellSize, const FVector& InOrigin)
+	{
+		CellSize = FMath::Max(InCellSize, 1.0f);
+		Origin = InOrigin;
+		Reset();
+	}
+
+	void Reset()
+	{
+		for (FGrid& Grid : TypeGrids)
+		{
+			Grid = FGrid();
+		}
+		AllGrid = FGrid();
+		Locations.Reset();
+	}
+
+	// Insert or move a building (false if it was already indexed at that cell)
+	bool Add(const ElementType& Building, EBuildingType BuildingType, const FVector& Location)
+	{
+		if (Building == ElementType())
+		{
+			return false;
+		}
+
+		const FIntPoint Cell = ToCell(Location);
+		if (const FLocation* Existing = Locations.Find(Building))
+		{
+			if (Existing->Cell == Cell && Existing->BuildingType == BuildingType)
+			{
+				return false;
+			}
+			Remove(Building);
+		}
+
+		const FEntry Entry = { Building, Location };
+		GetTypeGrid(BuildingType).Add(Cell, Entry);
+		AllGrid.Add(Cell, Entry);
+		Locations.Add(Building, { BuildingType, Location, Cell });
+		return true;
+	}
+
+	// Remove a building (false if it wasn't indexed)
+	bool Remove(const ElementType& Building)
+	{
+		FLocation Location;
+		if (Building == ElementType() || !Locations.RemoveAndCopyValue(Building, Location))
+		{
+			return false;
+		}
+
+		GetTypeGrid(Location.BuildingType).Remove(Location.Cell, Building);
+		AllGrid.Remove(Location.Cell, Building);
+		return true;
+	}
+
+	bool Contains(const ElementType& Building) const { return Locations.Contains(Building); }
+
+	int32 Num() const { return Locations.Num(); }
+
+	float GetCellSize() const { return CellSize; }
+
+	// Nearest building of any of the given types that passes Filter (default element if none)
+	ElementType FindNearest(const FVector& Location, TConstArrayView<EBuildingType> BuildingTypes,
+		TFunctionRef<bool(ElementType)> Filter) const
+	{
+		// Grids to search and the cell range they cover
+		TArray<const FGrid*, TInlineAllocator<4>> Grids;
+		FIntPoint MinCell(MAX_int32, MAX_int32);
+		FIntPoint MaxCell(MIN_int32, MIN_int32);
+		for (EBuildingType BuildingType : BuildingTypes)
+		{
+			const FGrid& Grid = GetTypeGrid(BuildingType);
+			if (Grid.Num > 0 && !Grids.Contains(&Grid))
+			{
+				Grids.Add(&Grid);
+				MinCell = FIntPoint(FMath::Min(MinCell.X, Grid.MinCell.X), FMath::Min(MinCell.Y, Grid.MinCell.Y));
+				MaxCell = FIntPoint(FMath::Max(MaxCell.X, Grid.MaxCell.X), FMath::Max(MaxCell.Y, Grid.MaxCell.Y));
+			}
+		}
+
+		if (Grids.Num() == 0)
+		{
+			return ElementType();
+		}
+
+		// Rings that can touch the occupied bounds
+		const FIntPoint Center = ToCell(Location);
+		const int32 MinRing = FMath::Max3(0, FMath::Max(MinCell.X - Center.X, Center.X - MaxCell.X), FMath::Max(MinCell.Y - Center.Y, Center.Y - MaxCell.Y));
+		const int32 MaxRing = FMath::Max(
+			FMath::Max(FMath::Abs(Center.X - MinCell.X), FMath::Abs(MaxCell.X - Center.X)),
+			FMath::Max(FMath::Abs(Center.Y - MinCell.Y), FMath::Abs(MaxCell.Y - Center.Y)));
+
+		ElementType Nearest = ElementType();
+		bool bFound = false;
+		double NearestDistSq = TNumericLimits<double>::Max();
+
+		auto VisitCell = [&](int32 X, int32 Y)
+		{
+			for (const FGrid* Grid : Grids)
+			{
+				const TArray<FEntry>* Entries = Grid->Cells.Find(FIntPoint(X, Y));
+				if (!Entries)
+				{
+					continue;
+				}
+
+				for (const FEntry& Entry : *Entries)
+				{
+					const double DistSq = FVector::DistSquared(Location, Entry.Location);
+					if (DistSq < NearestDistSq && Filter(Entry.Building))
+					{
+						NearestDistSq = DistSq;
+						Nearest = Entry.Building;
+						bFound = true;
+					}
+				}
+			}
+		};
+
+		for (int32 R = MinRing; R <= MaxRing; R++)
+		{
+			if (R == 0)
+			{
+				VisitCell(Center.X, Center.Y);
+			}
+			else
+			{
+				// Top and bottom rows, then the columns between them (clipped to the occupied bounds)
+				const int32 RowMinX = FMath::Max(Center.X - R, MinCell.X);
+				const int32 RowMaxX = FMath::Min(Center.X + R, MaxCell.X);
+				for (int32 Y : { Center.Y - R, Center.Y + R })
+				{
+					if (Y < MinCell.Y || Y > MaxCell.Y)
+					{
+						continue;
+					}
+					for (int32 X = RowMinX; X <= RowMaxX; X++)
+					{
+						VisitCell(X, Y);
+					}
+				}
+
+				const int32 ColMinY = FMath::Max(Center.Y - R + 1, MinCell.Y);
+				const int32 ColMaxY = FMath::Min(Center.Y + R - 1, MaxCell.Y);
+				for (int32 X : { Center.X - R, Center.X + R })
+				{
+					if (X < MinCell.X || X > MaxCell.X)
+					{
+						continue;
+					}
+					for (int32 Y = ColMinY; Y <= ColMaxY; Y++)
+					{
+						VisitCell(X, Y);
+					}
+				}
+			}
+
+			// Anything in ring R+1 or beyond is at least R cells away
+			const double RingDistance = (double)R * CellSize;
+			if (bFound && NearestDistSq <= RingDistance * RingDistance)
+			{
+				break;
+			}
+		}
+
+		return Nearest;
+	}
+
+	// All buildings (any type) within Radius, appended to OutBuildings
+	void FindWithinRadius(const FVector& Location, float Radius, TArray<ElementType>& OutBuildings) const
+	{
+		if (AllGrid.Num == 0 || Radius < 0.0f)
+		{
+			return;
+		}
+
+		const double RadiusSq = (double)Radius * Radius;
+		const FIntPoint MinCell = ToCell(Location - FVector(Radius, Radius, 0.0f)).ComponentMax(AllGrid.MinCell);
+		const FIntPoint MaxCell = ToCell(Location + FVector(Radius, Radius, 0.0f)).ComponentMin(AllGrid.MaxCell);
+		if (MinCell.X > MaxCell.X || MinCell.Y > MaxCell.Y)
+		{
+			return;
+		}
+
+		auto AddInRange = [&](const TArray<FEntry>& Entries)
+		{
+			for (const FEntry& Entry : Entries)
+			{
+				if (FVector::DistSquared(Location, Entry.Location) <= RadiusSq)
+				{
+					OutBuildings.Add(Entry.Building);
+				}
+			}
+		};
+
+		// Radius covers more cells than are occupied - walk the occupied ones instead
+		const int64 RectCells = (int64)(MaxCell.X - MinCell.X + 1) * (MaxCell.Y - MinCell.Y + 1);
+		if (RectCells > AllGrid.Cells.Num())
+		{
+			for (const auto& Pair : AllGrid.Cells)
+			{
+				const FIntPoint& Cell = Pair.Key;
+				if (Cell.X >= MinCell.X && Cell.X <= MaxCell.X && Cell.Y >= MinCell.Y && Cell.Y <= MaxCell.Y)
+				{
+					AddInRange(Pair.Value);
+				}
+			}
+			return;
+		}
+
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; Y++)
+		{
+			for (int32 X = MinCell.X; X <= MaxCell.X; X++)
+			{
+				if (const TArray<FEntry>* Entries = AllGrid.Cells.Find(FIntPoint(X, Y)))
+				{
+					AddInRange(*Entries);
+				}
+			}
+		}
+	}
+
+private:
+	struct FEntry
+	{
+		ElementType Building;
+		FVector Location;
+	};
+
+	struct FGrid
+	{
+		TMap<FIntPoint, TArray<FEntry>> Cells;
+
+		// Occupied cell bounds (grow only, reset when the grid empties)
+		FIntPoint MinCell = FIntPoint(MAX_int32, MAX_int32);
+		FIntPoint MaxCell = FIntPoint(MIN_int32, MIN_int32);
+
+		int32 Num = 0;
+
+		void Add(const FIntPoint& Cell, const FEntry& Entry)
+		{
+			Cells.FindOrAdd(Cell).Add(Entry);
+
+			MinCell = FIntPoint(FMath::Min(MinCell.X, Cell.X), FMath::Min(MinCell.Y, Cell.Y));
+			MaxCell = FIntPoint(FMath::Max(MaxCell.X, Cell.X), FMath::Max(MaxCell.Y, Cell.Y));
+			Num++;
+		}
+
+		void Remove(const FIntPoint& Cell, const ElementType& Building)
+		{
+			TArray<FEntry>* Entries = Cells.Find(Cell);
+			if (!Entries)
+			{
+				return;
+			}
+
+			const int32 Index = Entries->IndexOfByPredicate([&Building](const FEntry& Entry) { return Entry.Building == Building; });
+			if (Index == INDEX_NONE)
+			{
+				return;
+			}
+
+			Entries->RemoveAtSwap(Index);
+			if (Entries->Num() == 0)
+			{
+				Cells.Remove(Cell);
+			}
+
+			if (--Num == 0)
+			{
+				MinCell = FIntPoint(MAX_int32, MAX_int32);
+				MaxCell = FIntPoint(MIN_int32, MIN_int32);
+			}
+		}
+	};
+
+	struct FLocation
+	{
+		EBuildingType BuildingType;
+		FVector Location;
+		FIntPoint Cell;
+	};
+
+	FIntPoint ToCell(const FVector& Location) const
+	{
+		return FIntPoint(
+			FMath::FloorToInt((Location.X - Origin.X) / CellSize),
+			FMath::FloorToInt((Location.Y - Origin.Y) / CellSize));
+	}
+
+	FGrid& GetTypeGrid(EBuildingType BuildingType)
+	{
+		return TypeGrids[FMath::Clamp(static_cast<int32>(BuildingType), 0, NumBuildingTypes - 1)];
+	}
+
+	const FGrid& GetTypeGrid(EBuildingType BuildingType) const
+	{
+		return TypeGrids[FMath::Clamp(static_cast<int32>(BuildingType), 0, NumBuildingTypes - 1)];
+	}
+
+	// One grid per EBuildingType
+	FGrid TypeGrids[NumBuildingTypes];
+
+	// Every building regardless of type (radius queries)
+	FGrid AllGrid;
+
+	// Where each indexed building is
+	TMap<ElementType, FLocation> Locations;
+
+	// Cell size in world units (AZoneGrid default: 50m)
+	float CellSize = 5000.0f;
+
+	FVector Origin = FVector::ZeroVector;
+};
+
+// Index over live building actors
+using FBuildingSpatialIndex = TBuildingSpatialIndex<ABaseBuilding*>;
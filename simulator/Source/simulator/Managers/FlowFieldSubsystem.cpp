@@ -0,0 +1,173 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FlowFieldSubsystem.h"
+#include "ZoneManagerSubsystem.h"
+#include "ZoneGrid.h"
+#include "BaseBuilding.h"
+#include "Engine/World.h"
+#include "Stats/Stats.h"
+
+void UFlowFieldSubsystem::Deinitialize()
+{
+	ClearFlowFields();
+	Super::Deinitialize();
+}
+
+bool UFlowFieldSubsystem::SampleZoneFlow(ETerrainZone ZoneType, FVector Location, FVector& OutDirection)
+{
+	AZoneGrid* ZoneGrid = GetZoneGrid();
+	if (!ZoneGrid)
+		return false;
+
+	const int32 ZoneIndex = static_cast<int32>(ZoneType);
+	if (!ZoneFields.IsValidIndex(ZoneIndex))
+	{
+		ZoneFields.SetNum(ZoneIndex + 1);
+	}
+
+	FCachedFlowField& Cached = ZoneFields[ZoneIndex];
+	if (!Cached.Field.IsBuilt() || Cached.GridVersion != ZoneGrid->GetCellDataVersion())
+	{
+		QUICK_SCOPE_CYCLE_COUNTER(STAT_FlowField_BuildZone);
+
+		const TArray<uint8>& ZoneTypeLayer = ZoneGrid->GetZoneTypeLayer();
+		TArray<int32> GoalIndices;
+		for (int32 Index = 0; Index < ZoneTypeLayer.Num(); Index++)
+		{
+			if (ZoneTypeLayer[Index] == static_cast<uint8>(ZoneType))
+			{
+				GoalIndices.Add(Index);
+			}
+		}
+
+		TArray<uint32> StepCosts;
+		ZoneGrid->GetZoneStepCosts(StepCosts);
+		Cached.Field.Build(ZoneTypeLayer, ZoneGrid->GridSizeX, ZoneGrid->GridSizeY, GoalIndices, StepCosts);
+		Cached.GridVersion = ZoneGrid->GetCellDataVersion();
+	}
+
+	Cached.LastUsedTime = GetWorld()->GetTimeSeconds();
+	return SampleField(Cached.Field, ZoneGrid, Location, OutDirection);
+}
+
+bool UFlowFieldSubsystem::SampleBuildingFlow(ABaseBuilding* Building, FVector Location, FVector& OutDirection)
+{
+	AZoneGrid* ZoneGrid = GetZoneGrid();
+	if (!ZoneGrid || !Building)
+		return false;
+
+	FCachedFlowField* Cached = BuildingFields.Find(Building);
+	if (!Cached)
+	{
+		EvictBuildingFields();
+		Cached = &BuildingFields.Add(Building);
+	}
+
+	if (!Cached->Field.IsBuilt() || Cached->GridVersion != ZoneGrid->GetCellDataVersion())
+	{
+		QUICK_SCOPE_CYCLE_COUNTER(STAT_FlowField_BuildBuilding);
+
+		// Every cell under the building footprint is a goal
+		FIntPoint MinCoords;
+		FIntPoint MaxCoords;
+		ZoneGrid->GetFootprintCellBounds(Building->GetActorLocation(), Building->GetActorRotation(),
+			Building->FootprintSize, MinCoords, MaxCoords);
+
+		TArray<int32> GoalIndices;
+		for (int32 Y = MinCoords.Y; Y <= MaxCoords.Y; Y++)
+		{
+			for (int32 X = MinCoords.X; X <= MaxCoords.X; X++)
+			{
+				if (ZoneGrid->IsValidGridCoords(X, Y))
+				{
+					GoalIndices.Add(ZoneGrid->GridCoordsToIndex(X, Y));
+				}
+			}
+		}
+
+		TArray<uint32> StepCosts;
+		ZoneGrid->GetZoneStepCosts(StepCosts);
+		Cached->Field.Build(ZoneGrid->GetZoneTypeLayer(), ZoneGrid->GridSizeX, ZoneGrid->GridSizeY, GoalIndices, StepCosts);
+		Cached->GridVersion = ZoneGrid->GetCellDataVersion();
+	}
+
+	Cached->LastUsedTime = GetWorld()->GetTimeSeconds();
+	return SampleField(Cached->Field, ZoneGrid, Location, OutDirection);
+}
+
+void UFlowFieldSubsystem::ClearFlowFields()
+{
+	ZoneFields.Empty();
+	BuildingFields.Empty();
+}
+
+int32 UFlowFieldSubsystem::GetCachedFieldCount() const
+{
+	int32 Count = BuildingFields.Num();
+	for (const FCachedFlowField& Cached : ZoneFields)
+	{
+		Count += Cached.Field.IsBuilt() ? 1 : 0;
+	}
+	return Count;
+}
+
+AZoneGrid* UFlowFieldSubsystem::GetZoneGrid() const
+{
+	UZoneManagerSubsystem* ZoneManager = GetWorld() ? GetWorld()->GetSubsystem<UZoneManagerSubsystem>() : nullptr;
+	AZoneGrid* ZoneGrid = ZoneManager ? ZoneManager->GetZoneGrid() : nullptr;
+
+	// Whole-grid fields need monolithic cell data
+	if (!ZoneGrid || ZoneGrid->bUseChunkedStorage || ZoneGrid->GetZoneTypeLayer().Num() != ZoneGrid->GetTotalCells())
+		return nullptr;
+
+	return ZoneGrid;
+}
+
+void UFlowFieldSubsystem::EvictBuildingFields()
+{
+	for (auto It = BuildingFields.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	while (BuildingFields.Num() >= FMath::Max(MaxBuildingFields, 1))
+	{
+		TWeakObjectPtr<ABaseBuilding> OldestKey;
+		double OldestTime = TNumericLimits<double>::Max();
+		for (const TPair<TWeakObjectPtr<ABaseBuilding>, FCachedFlowField>& Pair : BuildingFields)
+		{
+			if (Pair.Value.LastUsedTime < OldestTime)
+			{
+				OldestTime = Pair.Value.LastUsedTime;
+				OldestKey = Pair.Key;
+			}
+		}
+		BuildingFields.Remove(OldestKey);
+	}
+}
+
+bool UFlowFieldSubsystem::SampleField(const FZoneFlowField& Field, const AZoneGrid* ZoneGrid, FVector Location, FVector& OutDirection) const
+{
+	const FIntPoint Coords = ZoneGrid->WorldToGridCoords(Location);
+	if (!ZoneGrid->IsValidGridCoords(Coords.X, Coords.Y))
+		return false;
+
+	const uint8 Direction = Field.GetDirection(ZoneGrid->GridCoordsToIndex(Coords.X, Coords.Y));
+	if (Direction == FZoneFlowField::Unreachable)
+		return false;
+
+	if (Direction == FZoneFlowField::AtGoal)
+	{
+		OutDirection = FVector::ZeroVector;
+		return true;
+	}
+
+	// Head for the center of the next cell (smoother than snapping to 8 directions)
+	const FIntPoint Step = FZoneFlowField::GetDirectionStep(Direction);
+	const FVector NextCellCenter = ZoneGrid->GridCoordsToWorld(Coords.X + Step.X, Coords.Y + Step.Y);
+	OutDirection = (NextCellCenter - Location).GetSafeNormal2D();
+	return true;
+}
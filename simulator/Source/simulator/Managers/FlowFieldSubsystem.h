@@ -0,0 +1,78 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SimulatorTypes.h"
+#include "ZoneFlowField.h"
+#include "FlowFieldSubsystem.generated.h"
+
+class AZoneGrid;
+class ABaseBuilding;
+
+/**
+ * Shared flow fields over the ZoneGrid raster
+ * One field per target zone type or goal building is built on first use and
+ * shared by every villager heading there, so per-agent steering is a single
+ * cell lookup instead of a nearest-cell search plus navmesh path.
+ *
+ * Fields rebuild lazily when the grid's cell data version changes.
+ * Requires a monolithic (non-chunked) ZoneGrid.
+ */
+UCLASS()
+class SIMULATOR_API UFlowFieldSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem implementation
+	virtual void Deinitialize() override;
+
+	// Steering direction toward the cheapest reachable cell of a zone type
+	// (unit XY vector, zero once inside the zone; false if unreachable or no grid)
+	UFUNCTION(BlueprintCallable, Category = "Flow Field")
+	bool SampleZoneFlow(ETerrainZone ZoneType, FVector Location, FVector& OutDirection);
+
+	// Steering direction toward a building's footprint (zero once on it)
+	UFUNCTION(BlueprintCallable, Category = "Flow Field")
+	bool SampleBuildingFlow(ABaseBuilding* Building, FVector Location, FVector& OutDirection);
+
+	// Drop all cached fields
+	UFUNCTION(BlueprintCallable, Category = "Flow Field")
+	void ClearFlowFields();
+
+	// Number of fields currently cached
+	UFUNCTION(BlueprintCallable, Category = "Flow Field")
+	int32 GetCachedFieldCount() const;
+
+	// Building fields kept before the least recently used one is dropped
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Flow Field")
+	int32 MaxBuildingFields = 32;
+
+protected:
+	struct FCachedFlowField
+	{
+		FZoneFlowField Field;
+
+		// Grid cell data version the field was built from
+		uint32 GridVersion = 0;
+
+		// World time of last sample (for eviction)
+		double LastUsedTime = 0.0;
+	};
+
+	// Fields per target zone type (indexed by ETerrainZone)
+	TArray<FCachedFlowField> ZoneFields;
+
+	// Fields per goal building
+	TMap<TWeakObjectPtr<ABaseBuilding>, FCachedFlowField> BuildingFields;
+
+	AZoneGrid* GetZoneGrid() const;
+
+	// Drop least recently used / destroyed building fields until there is room for one more
+	void EvictBuildingFields();
+
+	// Convert field direction at a location into a world steering vector
+	bool SampleField(const FZoneFlowField& Field, const AZoneGrid* ZoneGrid, FVector Location, FVector& OutDirection) const;
+};
@@ -10,26 +10,24 @@ void UResourceManagerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
 
-	RefreshInterval = 2.0f; // 2초마다 자원 캐시 갱신
-	LastRefreshTime = 0.0f;
-
-	// 초기 갱신
-	RefreshResourceCache();
-
-	// 주기적 갱신 타이머 설정
-	if (RefreshInterval > 0.0f && GetWorld())
+	// 총량은 창고 변화량으로 갱신 - 전체 재집계는 개발 빌드의 일관성 검사에서만
+#if UE_BUILD_SHIPPING
+	VerifyInterval = 0.0f;
+#else
+	VerifyInterval = 30.0f;
+#endif
+
+	if (VerifyInterval > 0.0f && GetWorld())
 	{
 		GetWorld()->GetTimerManager().SetTimer(
-			RefreshTimerHandle,
-			this,
-			&UResourceManagerSubsystem::RefreshResourceCache,
-			RefreshInterval,
+			VerifyTimerHandle,
+			FTimerDelegate::CreateWeakLambda(this, [this]() { VerifyResourceTotals(); }),
+			VerifyInterval,
 			true
 		);
 	}
 
 	UE_LOG(LogTemp, Log, TEXT("ResourceManagerSubsystem initialized"));
-	LogResourceStatus();
 }
 
 void UResourceManagerSubsystem::Deinitialize()
@@ -37,61 +35,121 @@ void UResourceManagerSubsystem::Deinitialize()
 	// 타이머 정리
 	if (GetWorld())
 	{
-		GetWorld()->GetTimerManager().ClearTimer(RefreshTimerHandle);
+		GetWorld()->GetTimerManager().ClearTimer(VerifyTimerHandle);
+	}
+
+	// 구독 해제
+	for (const auto& Pair : StorageInventories)
+	{
+		if (UInventoryComponent* Inventory = Pair.Key.Get())
+		{
+			Inventory->OnResourceChanged.Remove(Pair.Value);
+		}
 	}
+	StorageInventories.Empty();
 
-	CachedResourceTotals.Empty();
+	CachedResourceTotals.Reset();
+	ReservedTotals.Reset();
+	Reservations.Empty();
 
 	Super::Deinitialize();
 }
 
-void UResourceManagerSubsystem::RefreshResourceCache()
+void UResourceManagerSubsystem::RegisterStorageInventory(UInventoryComponent* Inventory)
 {
-	CachedResourceTotals.Empty();
-
-	if (!GetWorld())
+	if (!Inventory || StorageInventories.Contains(Inventory))
 	{
 		return;
 	}
 
-	// BuildingManagerSubsystem에서 모든 창고 가져오기
-	UBuildingManagerSubsystem* BuildingManager = GetWorld()->GetSubsystem<UBuildingManagerSubsystem>();
-	if (!BuildingManager)
+	StorageInventories.Add(Inventory, Inventory->OnResourceChanged.AddUObject(this, &UResourceManagerSubsystem::HandleInventoryChanged));
+
+	// 이미 들어있는 자원 합산
+	CachedResourceTotals += Inventory->GetResources();
+}
+
+void UResourceManagerSubsystem::UnregisterStorageInventory(UInventoryComponent* Inventory)
+{
+	FDelegateHandle Handle;
+	if (!Inventory || !StorageInventories.RemoveAndCopyValue(Inventory, Handle))
 	{
 		return;
 	}
 
-	TArray<ABaseBuilding*> StorageBuildings = BuildingManager->GetAllStorageBuildings();
+	Inventory->OnResourceChanged.Remove(Handle);
 
-	// 모든 창고의 자원 합산
-	for (ABaseBuilding* Building : StorageBuildings)
+	CachedResourceTotals -= Inventory->GetResources();
+}
+
+void UResourceManagerSubsystem::HandleInventoryChanged(UInventoryComponent* Inventory, EResourceType ResourceType, int32 Delta)
+{
+	ApplyDelta(ResourceType, Delta);
+}
+
+void UResourceManagerSubsystem::ApplyDelta(EResourceType ResourceType, int32 Delta)
+{
+	CachedResourceTotals.Add(ResourceType, Delta);
+}
+
+bool UResourceManagerSubsystem::VerifyResourceTotals()
+{
+	// 등록된 창고 전체 재집계
+	FResourceVector Recounted;
+	for (auto It = StorageInventories.CreateIterator(); It; ++It)
 	{
-		if (Building && Building->Inventory)
+		UInventoryComponent* Inventory = It.Key().Get();
+		if (!Inventory)
+		{
+			// 등록 해제 없이 사라진 창고 - 남은 자원은 알 수 없으므로 재집계 값으로 보정
+			It.RemoveCurrent();
+			continue;
+		}
+
+		Recounted += Inventory->GetResources();
+	}
+
+	bool bConsistent = Recounted == CachedResourceTotals;
+	if (!bConsistent)
+	{
+		for (int32 Index = 0; Index < NumResourceTypes; ++Index)
 		{
-			TArray<FResourceStack> Resources = Building->Inventory->GetAllResources();
-			for (const FResourceStack& Stack : Resources)
+			const EResourceType Type = static_cast<EResourceType>(Index);
+			if (Recounted.Get(Type) != CachedResourceTotals.Get(Type))
 			{
-				if (!CachedResourceTotals.Contains(Stack.ResourceType))
-				{
-					CachedResourceTotals.Add(Stack.ResourceType, 0);
-				}
-				CachedResourceTotals[Stack.ResourceType] += Stack.Quantity;
+				UE_LOG(LogTemp, Error, TEXT("ResourceManager: Total mismatch for %d (running %d, recount %d)"),
+					Index, CachedResourceTotals.Get(Type), Recounted.Get(Type));
 			}
 		}
 	}
 
-	LastRefreshTime = GetWorld()->GetTimeSeconds();
+	if (!bConsistent)
+	{
+		UE_LOG(LogTemp, Error, TEXT("ResourceManager: Running totals out of sync with %d storage inventories, resetting to recount"),
+			StorageInventories.Num());
+		CachedResourceTotals = Recounted;
+	}
+
+	return bConsistent;
 }
 
 int32 UResourceManagerSubsystem::GetTotalResource(EResourceType ResourceType) const
 {
-	const int32* Found = CachedResourceTotals.Find(ResourceType);
-	return Found ? *Found : 0;
+	return CachedResourceTotals.Get(ResourceType);
+}
+
+int32 UResourceManagerSubsystem::GetAvailableResource(EResourceType ResourceType) const
+{
+	return GetTotalResource(ResourceType) - GetReservedResource(ResourceType);
+}
+
+int32 UResourceManagerSubsystem::GetReservedResource(EResourceType ResourceType) const
+{
+	return ReservedTotals.Get(ResourceType);
 }
 
 bool UResourceManagerSubsystem::HasEnoughResource(EResourceType ResourceType, int32 RequiredAmount) const
 {
-	return GetTotalResource(ResourceType) >= RequiredAmount;
+	return GetAvailableResource(ResourceType) >= RequiredAmount;
 }
 
 bool UResourceManagerSubsystem::HasEnoughResources(const TArray<FResourceStack>& RequiredResources) const
@@ -108,83 +166,164 @@ bool UResourceManagerSubsystem::HasEnoughResources(const TArray<FResourceStack>&
 
 TMap<EResourceType, int32> UResourceManagerSubsystem::GetAllResourceTotals() const
 {
-	return CachedResourceTotals;
+	TMap<EResourceType, int32> Totals;
+	for (const FResourceStack& Stack : CachedResourceTotals)
+	{
+		if (Stack.Quantity > 0)
+		{
+			Totals.Add(Stack.ResourceType, Stack.Quantity);
+		}
+	}
+	return Totals;
 }
 
 bool UResourceManagerSubsystem::DeductResource(EResourceType ResourceType, int32 Amount)
 {
-	if (!HasEnoughResource(ResourceType, Amount))
+	return DeductResources({ FResourceStack(ResourceType, Amount) });
+}
+
+bool UResourceManagerSubsystem::DeductResources(const TArray<FResourceStack>& Resources)
+{
+	// 예약이 성공하면 확정은 전부 차감 - 중간 실패/롤백 없음
+	FResourceReservationHandle Handle = ReserveResources(Resources);
+	if (!Handle.IsValid())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ResourceManager: Not enough %d (need %d, have %d)"),
-			(int32)ResourceType, Amount, GetTotalResource(ResourceType));
+		UE_LOG(LogTemp, Warning, TEXT("ResourceManager: Not enough resources for deduction"));
+		LogResourceStatus();
 		return false;
 	}
 
-	if (!GetWorld())
+	return CommitReservation(Handle);
+}
+
+FResourceReservationHandle UResourceManagerSubsystem::ReserveResources(const TArray<FResourceStack>& Resources)
+{
+	FResourceReservationHandle Handle;
+
+	// 같은 타입이 여러 번 들어와도 합쳐서 확인
+	TArray<FResourceStack> Bundle;
+	for (const FResourceStack& Stack : Resources)
 	{
-		return false;
+		if (Stack.Quantity <= 0)
+		{
+			continue;
+		}
+
+		FResourceStack* Existing = Bundle.FindByPredicate([&Stack](const FResourceStack& Entry)
+		{
+			return Entry.ResourceType == Stack.ResourceType;
+		});
+
+		if (Existing)
+		{
+			Existing->Quantity += Stack.Quantity;
+		}
+		else
+		{
+			Bundle.Add(Stack);
+		}
 	}
 
-	// BuildingManagerSubsystem에서 창고 가져오기
-	UBuildingManagerSubsystem* BuildingManager = GetWorld()->GetSubsystem<UBuildingManagerSubsystem>();
-	if (!BuildingManager)
+	// 하나라도 부족하면 아무것도 예약하지 않음
+	for (const FResourceStack& Stack : Bundle)
+	{
+		if (GetAvailableResource(Stack.ResourceType) < Stack.Quantity)
+		{
+			UE_LOG(LogTemp, Verbose, TEXT("ResourceManager: Reservation refused - %d (need %d, available %d)"),
+				(int32)Stack.ResourceType, Stack.Quantity, GetAvailableResource(Stack.ResourceType));
+			return Handle;
+		}
+	}
+
+	ApplyReservedDelta(Bundle, 1);
+
+	Handle.Id = NextReservationId++;
+	Reservations.Add(Handle.Id, MoveTemp(Bundle));
+
+	return Handle;
+}
+
+bool UResourceManagerSubsystem::CommitReservation(FResourceReservationHandle& Handle)
+{
+	TArray<FResourceStack> Bundle;
+	if (!Handle.IsValid() || !Reservations.RemoveAndCopyValue(Handle.Id, Bundle))
 	{
+		UE_LOG(LogTemp, Warning, TEXT("ResourceManager: Commit of unknown reservation %d"), Handle.Id);
 		return false;
 	}
 
-	TArray<ABaseBuilding*> StorageBuildings = BuildingManager->GetAllStorageBuildings();
+	Handle.Id = 0;
+	ApplyReservedDelta(Bundle, -1);
 
-	// 창고에서 순차적으로 차감
-	int32 RemainingAmount = Amount;
-	for (ABaseBuilding* Building : StorageBuildings)
+	// 예약 외 경로(직접 인벤토리 조작)로 창고가 비워졌으면 차감하지 않음
+	for (const FResourceStack& Stack : Bundle)
 	{
-		if (Building && Building->Inventory && RemainingAmount > 0)
+		if (GetTotalResource(Stack.ResourceType) < Stack.Quantity)
 		{
-			int32 Removed = Building->Inventory->RemoveResource(ResourceType, RemainingAmount);
-			RemainingAmount -= Removed;
-
-			if (Removed > 0)
-			{
-				UE_LOG(LogTemp, Log, TEXT("ResourceManager: Deducted %d x %d from %s"),
-					(int32)ResourceType, Removed, *Building->BuildingName);
-			}
+			UE_LOG(LogTemp, Error, TEXT("ResourceManager: Reserved %d x %d no longer in storage (have %d), reservation dropped"),
+				(int32)Stack.ResourceType, Stack.Quantity, GetTotalResource(Stack.ResourceType));
+			return false;
 		}
 	}
 
-	// 캐시 갱신
-	RefreshResourceCache();
-
-	bool bSuccess = (RemainingAmount == 0);
-	if (!bSuccess)
+	for (const FResourceStack& Stack : Bundle)
 	{
-		UE_LOG(LogTemp, Error, TEXT("ResourceManager: Failed to deduct full amount (missing %d)"), RemainingAmount);
+		RemoveFromStorages(Stack.ResourceType, Stack.Quantity);
 	}
 
-	return bSuccess;
+	return true;
 }
 
-bool UResourceManagerSubsystem::DeductResources(const TArray<FResourceStack>& Resources)
+bool UResourceManagerSubsystem::ReleaseReservation(FResourceReservationHandle& Handle)
 {
-	// 먼저 모든 자원이 충분한지 확인
-	if (!HasEnoughResources(Resources))
+	TArray<FResourceStack> Bundle;
+	if (!Handle.IsValid() || !Reservations.RemoveAndCopyValue(Handle.Id, Bundle))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ResourceManager: Not enough resources for deduction"));
-		LogResourceStatus();
 		return false;
 	}
 
-	// 모든 자원 차감
-	for (const FResourceStack& Stack : Resources)
+	Handle.Id = 0;
+	ApplyReservedDelta(Bundle, -1);
+
+	return true;
+}
+
+void UResourceManagerSubsystem::ApplyReservedDelta(const TArray<FResourceStack>& Bundle, int32 Sign)
+{
+	for (const FResourceStack& Stack : Bundle)
+	{
+		ReservedTotals.Add(Stack.ResourceType, Sign * Stack.Quantity);
+	}
+}
+
+int32 UResourceManagerSubsystem::RemoveFromStorages(EResourceType ResourceType, int32 Amount)
+{
+	// 창고에서 순차적으로 차감
+	int32 RemainingAmount = Amount;
+	for (const auto& Pair : StorageInventories)
 	{
-		if (!DeductResource(Stack.ResourceType, Stack.Quantity))
+		UInventoryComponent* Inventory = Pair.Key.Get();
+		if (!Inventory || RemainingAmount <= 0)
 		{
-			// 실패 시 롤백은 복잡하므로, 사전 체크로 방지
-			UE_LOG(LogTemp, Error, TEXT("ResourceManager: Deduction failed mid-process!"));
-			return false;
+			continue;
+		}
+
+		int32 Removed = Inventory->RemoveResource(ResourceType, RemainingAmount);
+		RemainingAmount -= Removed;
+
+		if (Removed > 0)
+		{
+			UE_LOG(LogTemp, Log, TEXT("ResourceManager: Deducted %d x %d from %s"),
+				(int32)ResourceType, Removed, *GetNameSafe(Inventory->GetOwner()));
 		}
 	}
 
-	return true;
+	if (RemainingAmount > 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("ResourceManager: Failed to deduct full amount (missing %d)"), RemainingAmount);
+	}
+
+	return Amount - RemainingAmount;
 }
 
 bool UResourceManagerSubsystem::RefundResources(const TArray<FResourceStack>& Resources, FVector Location)
@@ -218,9 +357,6 @@ bool UResourceManagerSubsystem::RefundResources(const TArray<FResourceStack>& Re
 		}
 	}
 
-	// 캐시 갱신
-	RefreshResourceCache();
-
 	return true;
 }
 
@@ -249,6 +385,11 @@ bool UResourceManagerSubsystem::PayConstructionCost(const FConstructionCost& Cos
 	return bSuccess;
 }
 
+FResourceReservationHandle UResourceManagerSubsystem::ReserveConstructionCost(const FConstructionCost& Cost)
+{
+	return ReserveResources(Cost.RequiredResources);
+}
+
 bool UResourceManagerSubsystem::RefundConstructionCost(const FConstructionCost& Cost, FVector Location)
 {
 	bool bSuccess = RefundResources(Cost.RequiredResources, Location);
@@ -266,20 +407,26 @@ void UResourceManagerSubsystem::LogResourceStatus() const
 {
 	UE_LOG(LogTemp, Warning, TEXT("=== Resource Status ==="));
 
-	if (CachedResourceTotals.Num() == 0)
+	if (CachedResourceTotals.IsEmpty())
 	{
 		UE_LOG(LogTemp, Warning, TEXT("No resources available"));
 		return;
 	}
 
-	// 자원 타입별로 정렬하여 출력
-	TArray<EResourceType> ResourceTypes;
-	CachedResourceTotals.GetKeys(ResourceTypes);
-
-	for (EResourceType Type : ResourceTypes)
+	// 자원 타입 순서대로 출력
+	for (const FResourceStack& Stack : CachedResourceTotals)
 	{
-		int32 Amount = CachedResourceTotals[Type];
-		UE_LOG(LogTemp, Warning, TEXT("  %d: %d"), (int32)Type, Amount);
+		EResourceType Type = Stack.ResourceType;
+		int32 Amount = Stack.Quantity;
+		int32 Reserved = GetReservedResource(Type);
+		if (Reserved > 0)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("  %d: %d (reserved %d)"), (int32)Type, Amount, Reserved);
+		}
+		else
+		{
+			UE_LOG(LogTemp, Warning, TEXT("  %d: %d"), (int32)Type, Amount);
+		}
 	}
 
 	UE_LOG(LogTemp, Warning, TEXT("======================"));
@@ -300,10 +447,8 @@ void UResourceManagerSubsystem::LogResourceDetails(EResourceType ResourceType) c
 		return;
 	}
 
-	TArray<ABaseBuilding*> StorageBuildings = BuildingManager->GetAllStorageBuildings();
-
 	int32 Total = 0;
-	for (ABaseBuilding* Building : StorageBuildings)
+	for (ABaseBuilding* Building : BuildingManager->GetStorageBuildingsView())
 	{
 		if (Building && Building->Inventory)
 		{
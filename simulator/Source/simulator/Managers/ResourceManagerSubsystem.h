@@ -7,10 +7,32 @@
 #include "SimulatorTypes.h"
 #include "ResourceManagerSubsystem.generated.h"
 
+/**
+ * 자원 예약 핸들
+ * ReserveResources로 받은 뒤 CommitReservation(차감) 또는 ReleaseReservation(취소)
+ */
+USTRUCT(BlueprintType)
+struct FResourceReservationHandle
+{
+	GENERATED_BODY()
+
+	// 예약 ID (0 = 예약 실패/무효)
+	UPROPERTY(BlueprintReadOnly, Category = "Resource Manager|Reservation")
+	int32 Id = 0;
+
+	bool IsValid() const { return Id != 0; }
+};
+
 /**
  * 영지 전체의 자원을 관리하는 WorldSubsystem
  * 모든 창고의 자원을 합산하여 총 자원량 추적
  * 건설 비용 검증 및 자원 차감
+ *
+ * 창고 인벤토리가 변화량을 통지하면 총량을 즉시 갱신 (변경당 O(1))
+ * 전체 재집계는 디버그용 일관성 검사로만 사용
+ *
+ * 예약 장부: 여러 자원을 한 번에 예약(전부 아니면 전무)하고 나중에 확정/취소
+ * 예약된 양은 다른 요청의 가용량에서 제외되므로 확정 중 부분 실패가 없다 (묶음 크기에 비례)
  */
 UCLASS()
 class SIMULATOR_API UResourceManagerSubsystem : public UWorldSubsystem
@@ -28,7 +50,11 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Resource Manager")
 	int32 GetTotalResource(EResourceType ResourceType) const;
 
-	// 특정 자원이 충분한지 확인
+	// 예약분을 뺀 가용량 조회
+	UFUNCTION(BlueprintCallable, Category = "Resource Manager")
+	int32 GetAvailableResource(EResourceType ResourceType) const;
+
+	// 특정 자원이 충분한지 확인 (예약분 제외)
 	UFUNCTION(BlueprintCallable, Category = "Resource Manager")
 	bool HasEnoughResource(EResourceType ResourceType, int32 RequiredAmount) const;
 
@@ -46,7 +72,7 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Resource Manager")
 	bool DeductResource(EResourceType ResourceType, int32 Amount);
 
-	// 여러 자원 한번에 차감
+	// 여러 자원 한번에 차감 (예약 후 확정 - 전부 차감되거나 아무것도 차감되지 않음)
 	UFUNCTION(BlueprintCallable, Category = "Resource Manager")
 	bool DeductResources(const TArray<FResourceStack>& Resources);
 
@@ -54,6 +80,28 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Resource Manager")
 	bool RefundResources(const TArray<FResourceStack>& Resources, FVector Location);
 
+	// === 자원 예약 ===
+
+	// 여러 자원을 한 번에 예약 (하나라도 부족하면 아무것도 예약하지 않고 무효 핸들 반환)
+	UFUNCTION(BlueprintCallable, Category = "Resource Manager|Reservation")
+	FResourceReservationHandle ReserveResources(const TArray<FResourceStack>& Resources);
+
+	// 예약분을 창고에서 실제로 차감 (핸들 소멸). 창고가 예약 외 경로로 비워졌으면 차감 없이 false
+	UFUNCTION(BlueprintCallable, Category = "Resource Manager|Reservation")
+	bool CommitReservation(UPARAM(ref) FResourceReservationHandle& Handle);
+
+	// 예약 취소 (핸들 소멸)
+	UFUNCTION(BlueprintCallable, Category = "Resource Manager|Reservation")
+	bool ReleaseReservation(UPARAM(ref) FResourceReservationHandle& Handle);
+
+	// 특정 자원의 예약량
+	UFUNCTION(BlueprintCallable, Category = "Resource Manager|Reservation")
+	int32 GetReservedResource(EResourceType ResourceType) const;
+
+	// 진행 중인 예약 수
+	UFUNCTION(BlueprintCallable, Category = "Resource Manager|Reservation")
+	int32 GetReservationCount() const { return Reservations.Num(); }
+
 	// === 건설 비용 검증 ===
 
 	// 건설 비용이 충분한지 확인
@@ -64,12 +112,28 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Resource Manager|Construction")
 	bool PayConstructionCost(const FConstructionCost& Cost);
 
+	// 건설 비용 예약 (건설 현장이 생기면 CommitReservation, 실패하면 ReleaseReservation)
+	UFUNCTION(BlueprintCallable, Category = "Resource Manager|Construction")
+	FResourceReservationHandle ReserveConstructionCost(const FConstructionCost& Cost);
+
 	// 건설 취소 시 자원 반환
 	UFUNCTION(BlueprintCallable, Category = "Resource Manager|Construction")
 	bool RefundConstructionCost(const FConstructionCost& Cost, FVector Location);
 
+	// === 창고 등록 ===
+
+	// 창고 인벤토리 등록 (현재 보유량 합산 + 변화량 구독)
+	void RegisterStorageInventory(class UInventoryComponent* Inventory);
+
+	// 창고 인벤토리 등록 해제 (보유량 차감 + 구독 해제)
+	void UnregisterStorageInventory(class UInventoryComponent* Inventory);
+
 	// === 디버그/통계 ===
 
+	// 전체 재집계 후 누적 총량과 비교 (불일치 시 로그 + 보정). 일치하면 true
+	UFUNCTION(BlueprintCallable, Category = "Resource Manager|Debug")
+	bool VerifyResourceTotals();
+
 	// 자원 현황 로그 출력
 	UFUNCTION(BlueprintCallable, Category = "Resource Manager|Debug")
 	void LogResourceStatus() const;
@@ -79,19 +143,37 @@ public:
 	void LogResourceDetails(EResourceType ResourceType) const;
 
 protected:
-	// 주기적으로 자원 캐시 갱신
-	void RefreshResourceCache();
+	// 창고 인벤토리 변화량 반영
+	void HandleInventoryChanged(class UInventoryComponent* Inventory, EResourceType ResourceType, int32 Delta);
+
+	// 누적 총량에 변화량 더하기
+	void ApplyDelta(EResourceType ResourceType, int32 Delta);
+
+	// 예약량에 변화량 더하기
+	void ApplyReservedDelta(const TArray<FResourceStack>& Bundle, int32 Sign);
+
+	// 등록된 창고에서 순차적으로 차감, 실제 차감량 반환
+	int32 RemoveFromStorages(EResourceType ResourceType, int32 Amount);
 
-	// 타이머 핸들
-	FTimerHandle RefreshTimerHandle;
+	// 일관성 검사 타이머 핸들 (Shipping 제외)
+	FTimerHandle VerifyTimerHandle;
 
-	// 갱신 주기 (초)
-	float RefreshInterval;
+	// 일관성 검사 주기 (초, 0 = 끔)
+	float VerifyInterval;
 
-	// 캐시된 자원 총량 (성능 최적화용)
+	// 자원 총량 (창고 변화량으로 누적 갱신)
 	UPROPERTY()
-	TMap<EResourceType, int32> CachedResourceTotals;
+	FResourceVector CachedResourceTotals;
+
+	// 등록된 창고 인벤토리와 구독 핸들
+	TMap<TWeakObjectPtr<class UInventoryComponent>, FDelegateHandle> StorageInventories;
+
+	// 타입별 예약 총량
+	FResourceVector ReservedTotals;
+
+	// 진행 중인 예약 (ID -> 타입별로 합친 묶음)
+	TMap<int32, TArray<FResourceStack>> Reservations;
 
-	// 마지막 갱신 시간
-	float LastRefreshTime;
+	// 다음 예약 ID
+	int32 NextReservationId = 1;
 };
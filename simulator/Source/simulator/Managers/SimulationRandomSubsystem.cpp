@@ -0,0 +1,81 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "SimulationRandomSubsystem.h"
+#include "Territory.h"
+#include "Engine/World.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "HAL/PlatformTime.h"
+
+void USimulationRandomSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// Fixed seed from the command line, otherwise a fresh one (logged so the run can be replayed)
+	int32 CommandLineSeed = 0;
+	if (FParse::Value(FCommandLine::Get(), TEXT("SimSeed="), CommandLineSeed))
+	{
+		Seed = CommandLineSeed;
+	}
+	else
+	{
+		Seed = static_cast<int32>(FPlatformTime::Cycles64() & 0x7FFFFFFF);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("SimulationRandomSubsystem initialized - Seed %d (replay with -SimSeed=%d)"), Seed, Seed);
+}
+
+void USimulationRandomSubsystem::Deinitialize()
+{
+	Streams.Empty();
+	Super::Deinitialize();
+}
+
+void USimulationRandomSubsystem::SetSeed(int32 NewSeed)
+{
+	Seed = NewSeed;
+	Streams.Empty();
+
+	UE_LOG(LogTemp, Log, TEXT("SimulationRandomSubsystem: Seed set to %d"), Seed);
+}
+
+float USimulationRandomSubsystem::FRandFromStream(FName StreamName)
+{
+	return GetStream(StreamName).FRand();
+}
+
+int32 USimulationRandomSubsystem::RandRangeFromStream(FName StreamName, int32 Min, int32 Max)
+{
+	return GetStream(StreamName).RandRange(Min, Max);
+}
+
+FSimRandomStream& USimulationRandomSubsystem::GetStream(FName StreamName)
+{
+	check(IsInGameThread());
+
+	if (FSimRandomStream* Stream = Streams.Find(StreamName))
+	{
+		return *Stream;
+	}
+
+	return Streams.Add(StreamName, FSimRandomStream(Seed, StreamName.ToString()));
+}
+
+FSimRandomStream& USimulationRandomSubsystem::GetTerritoryStream(const ATerritory* Territory)
+{
+	const FString ActorName = Territory ? Territory->GetFName().ToString() : FString(TEXT("None"));
+	return GetStream(FName(*FString::Printf(TEXT("Territory.%s"), *ActorName)));
+}
+
+FSimRandomStream& USimulationRandomSubsystem::GetWorldStream(const UObject* WorldContextObject, FName StreamName)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	if (USimulationRandomSubsystem* Random = World ? World->GetSubsystem<USimulationRandomSubsystem>() : nullptr)
+	{
+		return Random->GetStream(StreamName);
+	}
+
+	// Editor previews etc. still get reproducible values
+	static FSimRandomStream FallbackStream(0, TEXT("Fallback"));
+	return FallbackStream;
+}
@@ -0,0 +1,63 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SimRandomStream.h"
+#include "SimulationRandomSubsystem.generated.h"
+
+class ATerritory;
+
+/**
+ * Per-world simulation RNG
+ * Holds the run's seed (logged at startup, overridable with -SimSeed=N) and
+ * hands out named counter-based streams, one per subsystem and per territory.
+ * Same seed + same inputs = same simulation, independent of frame rate or
+ * thread scheduling.
+ *
+ * Streams are created on the game thread; parallel code should fetch the
+ * streams it needs up front and give each task its own.
+ */
+UCLASS()
+class SIMULATOR_API USimulationRandomSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem implementation
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// Seed of the current run
+	UFUNCTION(BlueprintCallable, Category = "Simulation Random")
+	int32 GetSeed() const { return Seed; }
+
+	// Reseed and restart every stream from its first value
+	UFUNCTION(BlueprintCallable, Category = "Simulation Random")
+	void SetSeed(int32 NewSeed);
+
+	// Uniform float in [0, 1) from a named stream
+	UFUNCTION(BlueprintCallable, Category = "Simulation Random")
+	float FRandFromStream(FName StreamName);
+
+	// Uniform integer in [Min, Max] from a named stream
+	UFUNCTION(BlueprintCallable, Category = "Simulation Random")
+	int32 RandRangeFromStream(FName StreamName, int32 Min, int32 Max);
+
+	// Named stream (e.g. "TurnManager", "VillagerAI"), created on first use
+	FSimRandomStream& GetStream(FName StreamName);
+
+	// Stream owned by one territory (keyed by its actor name, stable across runs)
+	FSimRandomStream& GetTerritoryStream(const ATerritory* Territory);
+
+	// Convenience lookup from any world object (falls back to a fixed-seed stream without a world)
+	static FSimRandomStream& GetWorldStream(const UObject* WorldContextObject, FName StreamName);
+
+protected:
+	// Seed all streams derive from
+	int32 Seed = 0;
+
+	// Streams by name
+	TMap<FName, FSimRandomStream> Streams;
+};
@@ -0,0 +1,225 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "TerritoryTurnSystems.h"
+#include "TurnPipeline.h"
+#include "BaseBuilding.h"
+#include "GuildHall.h"
+#include "ZoneGrid.h"
+#include "HAL/IConsoleManager.h"
+#include "Async/ParallelFor.h"
+
+namespace
+{
+	// Compute phase of territory production on worker threads (commits always run in order on the game thread)
+	bool GParallelTerritoryTurns = true;
+	FAutoConsoleVariableRef CVarParallelTerritoryTurns(
+		TEXT("sim.ParallelTerritoryTurns"),
+		GParallelTerritoryTurns,
+		TEXT("Compute territory turn deltas in parallel (1) or serially (0). Results are identical either way."));
+}
+
+void FTerritoryTurnSystems::Register(FTurnPipeline& Pipeline)
+{
+	FTurnSystem Production;
+	Production.Name = TEXT("TerritoryProduction");
+	Production.Phase = ETurnPhase::Production;
+	Production.Execute = [this](FTurnPhaseContext& Context) { return RunProduction(Context); };
+	Pipeline.RegisterSystem(MoveTemp(Production));
+
+	FTurnSystem Consumption;
+	Consumption.Name = TEXT("TerritoryConsumption");
+	Consumption.Phase = ETurnPhase::Consumption;
+	Consumption.Execute = [this](FTurnPhaseContext& Context) { return RunConsumption(Context); };
+	Pipeline.RegisterSystem(MoveTemp(Consumption));
+
+	FTurnSystem Training;
+	Training.Name = TEXT("GuildTraining");
+	Training.Phase = ETurnPhase::Training;
+	Training.Execute = [this](FTurnPhaseContext& Context) { return RunTraining(Context); };
+	Pipeline.RegisterSystem(MoveTemp(Training));
+
+	FTurnSystem ZoneDecay;
+	ZoneDecay.Name = TEXT("ZoneResources");
+	ZoneDecay.Phase = ETurnPhase::Decay;
+	ZoneDecay.Execute = [this](FTurnPhaseContext& Context) { return RunZoneDecay(Context); };
+	Pipeline.RegisterSystem(MoveTemp(ZoneDecay));
+}
+
+void FTerritoryTurnSystems::BeginTurn(const TArray<ATerritory*>& InTerritories, AZoneGrid* InZoneGrid)
+{
+	Reset();
+
+	for (ATerritory* Territory : InTerritories)
+	{
+		if (IsValid(Territory))
+		{
+			Territories.Add(Territory);
+		}
+	}
+
+	Deltas.SetNum(Territories.Num());
+	ZoneGrid = InZoneGrid;
+}
+
+void FTerritoryTurnSystems::Reset()
+{
+	Territories.Reset();
+	Deltas.Reset();
+	ZoneGrid.Reset();
+	ResetCursor();
+}
+
+void FTerritoryTurnSystems::ResetCursor()
+{
+	TerritoryIndex = 0;
+	BuildingIndex = 0;
+	Stock.Reset();
+	Buildings.Reset();
+}
+
+bool FTerritoryTurnSystems::RunProduction(FTurnPhaseContext& Context)
+{
+	if (!Context.IsTimeSliced() && TerritoryIndex == 0 && BuildingIndex == 0)
+	{
+		// Whole phase at once: territories only read their own buildings and stock, so compute side by side
+		TArray<ATerritory*> Valid;
+		Valid.SetNumZeroed(Territories.Num());
+		for (int32 Index = 0; Index < Territories.Num(); ++Index)
+		{
+			Valid[Index] = Territories[Index].Get();
+		}
+
+		ParallelFor(Valid.Num(), [this, &Valid](int32 Index)
+		{
+			if (Valid[Index])
+			{
+				Valid[Index]->ComputeTurnDelta(Deltas[Index]);
+			}
+		}, !GParallelTerritoryTurns || Valid.Num() < 2);
+
+		for (int32 Index = 0; Index < Valid.Num(); ++Index)
+		{
+			if (Valid[Index])
+			{
+				Valid[Index]->ApplyProductionDelta(Deltas[Index]);
+			}
+		}
+
+		ResetCursor();
+		return true;
+	}
+
+	// Time-sliced: one building per unit, each territory against a snapshot of its stock and buildings.
+	// The world can change between slices; CommitProduction re-checks inputs against the live stock.
+	while (Territories.IsValidIndex(TerritoryIndex))
+	{
+		ATerritory* Territory = Territories[TerritoryIndex].Get();
+		FTerritoryTurnDelta& Delta = Deltas[TerritoryIndex];
+
+		if (Territory && BuildingIndex == 0)
+		{
+			Stock = Territory->TerritoryResources;
+			Buildings.Reset(Territory->Buildings.Num());
+			for (ABaseBuilding* Building : Territory->Buildings)
+			{
+				Buildings.Add(Building);
+			}
+		}
+
+		if (Territory && Territory->TerritoryState == ETerritoryState::Owned && Buildings.IsValidIndex(BuildingIndex))
+		{
+			// Buildings destroyed since the snapshot resolve to nullptr and are skipped
+			Territory->ComputeBuildingOutput(Buildings[BuildingIndex].Get(), Stock, Delta);
+			BuildingIndex++;
+		}
+		else
+		{
+			// All buildings done (or the territory doesn't produce / was destroyed)
+			if (Territory)
+			{
+				Territory->ComputeConsumptionDelta(Delta);
+				Territory->ApplyProductionDelta(Delta);
+			}
+
+			TerritoryIndex++;
+			BuildingIndex = 0;
+		}
+
+		if (!Context.HasTimeLeft())
+			break;
+	}
+
+	Context.Progress = Territories.Num() > 0 ? static_cast<float>(TerritoryIndex) / Territories.Num() : 1.0f;
+
+	if (Territories.IsValidIndex(TerritoryIndex))
+		return false;
+
+	ResetCursor();
+	return true;
+}
+
+bool FTerritoryTurnSystems::RunConsumption(FTurnPhaseContext& Context)
+{
+	while (Territories.IsValidIndex(TerritoryIndex))
+	{
+		if (ATerritory* Territory = Territories[TerritoryIndex].Get())
+		{
+			Territory->ApplyConsumptionDelta(Deltas[TerritoryIndex]);
+		}
+		TerritoryIndex++;
+
+		if (!Context.HasTimeLeft())
+			break;
+	}
+
+	Context.Progress = Territories.Num() > 0 ? static_cast<float>(TerritoryIndex) / Territories.Num() : 1.0f;
+
+	if (Territories.IsValidIndex(TerritoryIndex))
+		return false;
+
+	ResetCursor();
+	return true;
+}
+
+bool FTerritoryTurnSystems::RunTraining(FTurnPhaseContext& Context)
+{
+	while (Territories.IsValidIndex(TerritoryIndex))
+	{
+		ATerritory* Territory = Territories[TerritoryIndex].Get();
+		if (Territory && Territory->Buildings.IsValidIndex(BuildingIndex))
+		{
+			AGuildHall* Guild = Cast<AGuildHall>(Territory->Buildings[BuildingIndex]);
+			if (Guild && Guild->bIsTraining)
+			{
+				Guild->ProcessTrainingTurn();
+			}
+			BuildingIndex++;
+		}
+		else
+		{
+			TerritoryIndex++;
+			BuildingIndex = 0;
+		}
+
+		if (!Context.HasTimeLeft())
+			break;
+	}
+
+	Context.Progress = Territories.Num() > 0 ? static_cast<float>(TerritoryIndex) / Territories.Num() : 1.0f;
+
+	if (Territories.IsValidIndex(TerritoryIndex))
+		return false;
+
+	ResetCursor();
+	return true;
+}
+
+bool FTerritoryTurnSystems::RunZoneDecay(FTurnPhaseContext& Context)
+{
+	// Batched resource depletion and regrowth on zone cells
+	if (AZoneGrid* Grid = ZoneGrid.Get())
+	{
+		Grid->ProcessResourceTurn();
+	}
+	return true;
+}
@@ -0,0 +1,57 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Territory.h"
+
+class ABaseBuilding;
+class AZoneGrid;
+class FTurnPipeline;
+struct FTurnPhaseContext;
+
+/**
+ * Built-in territory turn systems for FTurnPipeline
+ * Production, consumption, guild training and zone resource decay, each
+ * resumable at building/territory granularity so a time-sliced turn can
+ * stop after any unit of work.
+ *
+ * - Production computes every territory's FTerritoryTurnDelta; run to
+ *   completion, the compute step is spread over worker threads
+ *   (sim.ParallelTerritoryTurns), time-sliced it walks building by building
+ * - Territories are committed in registration order, so results match
+ *   ATerritory::ProcessTurn
+ */
+struct SIMULATOR_API FTerritoryTurnSystems
+{
+	// Register the systems into their phases
+	void Register(FTurnPipeline& Pipeline);
+
+	// Capture the territories (and zone grid) for the turn about to run
+	void BeginTurn(const TArray<ATerritory*>& InTerritories, AZoneGrid* InZoneGrid);
+
+	void Reset();
+
+private:
+	bool RunProduction(FTurnPhaseContext& Context);
+	bool RunConsumption(FTurnPhaseContext& Context);
+	bool RunTraining(FTurnPhaseContext& Context);
+	bool RunZoneDecay(FTurnPhaseContext& Context);
+
+	// Start the next system's walk over the territories
+	void ResetCursor();
+
+	TArray<TWeakObjectPtr<ATerritory>> Territories;
+	TWeakObjectPtr<AZoneGrid> ZoneGrid;
+
+	// Per territory, filled in production, applied in consumption
+	TArray<FTerritoryTurnDelta> Deltas;
+
+	// Cursor of the running system
+	int32 TerritoryIndex = 0;
+	int32 BuildingIndex = 0;
+
+	// Stock and building list of the territory being produced, taken together (time-sliced only)
+	FResourceVector Stock;
+	TArray<TWeakObjectPtr<ABaseBuilding>> Buildings;
+};
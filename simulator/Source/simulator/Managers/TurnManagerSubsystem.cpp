@@ -3,6 +3,163 @@
 #include "TurnManagerSubsystem.h"
 #include "BaseVillager.h"
 #include "Territory.h"
+#include "ZoneManagerSubsystem.h"
+#include "ZoneGrid.h"
+#include "SimulationRandomSubsystem.h"
+#include "SimTrace.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/App.h"
+#include "CoreGlobals.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Action Slots"), STAT_ActionSlots, STATGROUP_TurnManager);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Action Slots Min"), STAT_ActionSlotsMin, STATGROUP_TurnManager);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Action Slots Max"), STAT_ActionSlotsMax, STATGROUP_TurnManager);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Active Actions"), STAT_ActiveActions, STATGROUP_TurnManager);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pending Requests"), STAT_PendingRequests, STATGROUP_TurnManager);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Grant Interval (s)"), STAT_GrantInterval, STATGROUP_TurnManager);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Frame Time (ms)"), STAT_BudgetFrameMs, STATGROUP_TurnManager);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Target Frame Time (ms)"), STAT_BudgetTargetFrameMs, STATGROUP_TurnManager);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Action Time (ms/frame)"), STAT_BudgetActionMs, STATGROUP_TurnManager);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Cost per Action (ms/frame)"), STAT_BudgetCostPerActionMs, STATGROUP_TurnManager);
+
+namespace
+{
+	// Stand-in for FActionRequest keyed by plain requester index (no villagers needed)
+	struct FBenchmarkActionRequest
+	{
+		float Priority = 0.0f;
+		uint32 Sequence = 0;
+		int32 RequesterKey = INDEX_NONE;
+	};
+
+	// Grant throughput of the action queue vs. the old sort-every-tick array, with N villagers
+	// constantly re-requesting (steady-state queue size N, MaxSimultaneousActions grants per tick)
+	void BenchmarkActionQueue(const TArray<FString>& Args)
+	{
+		TArray<int32> RequesterCounts = { 1000, 10000, 50000 };
+		if (Args.Num() > 0)
+		{
+			RequesterCounts.Reset();
+			for (const FString& Arg : Args)
+			{
+				RequesterCounts.Add(FMath::Max(FCString::Atoi(*Arg), 1));
+			}
+		}
+
+		const int32 GrantsPerTick = 10;
+		const int32 HeapTicks = 10000;
+		const int32 LegacyTicks = 200;
+		FSimRandomStream RandomStream(12345, TEXT("ActionQueueBenchmark"));
+
+		auto MakeRequest = [&RandomStream](int32 Index)
+		{
+			FBenchmarkActionRequest Request;
+			Request.RequesterKey = Index;
+			Request.Priority = RandomStream.FRandRange(0.0f, 30.0f);
+			return Request;
+		};
+
+		for (const int32 NumRequesters : RequesterCounts)
+		{
+			// Indexed heap (same implementation as FActionRequestQueue)
+			TActionRequestHeap<FBenchmarkActionRequest, int32> Queue;
+			Queue.Reserve(NumRequesters);
+
+			double StartTime = FPlatformTime::Seconds();
+			for (int32 Index = 0; Index < NumRequesters; Index++)
+			{
+				Queue.Push(MakeRequest(Index));
+			}
+			const double PushSeconds = FPlatformTime::Seconds() - StartTime;
+
+			TArray<FBenchmarkActionRequest> Granted;
+			StartTime = FPlatformTime::Seconds();
+			for (int32 Tick = 0; Tick < HeapTicks; Tick++)
+			{
+				Granted.Reset();
+				FBenchmarkActionRequest Request;
+				while (Granted.Num() < GrantsPerTick && Queue.Pop(Request))
+				{
+					Granted.Add(Request);
+				}
+
+				// Completed actors request again
+				for (FBenchmarkActionRequest& Completed : Granted)
+				{
+					Completed.Priority = RandomStream.FRandRange(0.0f, 30.0f);
+					Queue.Push(Completed);
+				}
+			}
+			const double HeapSeconds = FPlatformTime::Seconds() - StartTime;
+
+			// Legacy: linear duplicate check, full sort and RemoveAt every tick
+			TArray<FBenchmarkActionRequest> Pending;
+			for (int32 Index = 0; Index < NumRequesters; Index++)
+			{
+				Pending.Add(MakeRequest(Index));
+			}
+
+			StartTime = FPlatformTime::Seconds();
+			for (int32 Tick = 0; Tick < LegacyTicks; Tick++)
+			{
+				Pending.Sort([](const FBenchmarkActionRequest& A, const FBenchmarkActionRequest& B) { return A.Priority < B.Priority; });
+
+				Granted.Reset();
+				for (int32 Index = Pending.Num() - 1; Index >= 0 && Granted.Num() < GrantsPerTick; Index--)
+				{
+					Granted.Add(Pending[Index]);
+					Pending.RemoveAt(Index);
+				}
+
+				for (FBenchmarkActionRequest& Completed : Granted)
+				{
+					const bool bDuplicate = Pending.ContainsByPredicate([&Completed](const FBenchmarkActionRequest& Request)
+					{
+						return Request.RequesterKey == Completed.RequesterKey;
+					});
+					if (!bDuplicate)
+					{
+						Completed.Priority = RandomStream.FRandRange(0.0f, 30.0f);
+						Pending.Add(Completed);
+					}
+				}
+			}
+			const double LegacySeconds = FPlatformTime::Seconds() - StartTime;
+
+			const double HeapGrantsPerSecond = HeapTicks * GrantsPerTick / FMath::Max(HeapSeconds, 1e-9);
+			const double LegacyGrantsPerSecond = LegacyTicks * GrantsPerTick / FMath::Max(LegacySeconds, 1e-9);
+
+			UE_LOG(LogTemp, Display, TEXT("ActionQueue %6d requesters: push %.2f ms | heap %.0f grants/s | sorted array %.0f grants/s (x%.1f)"),
+				NumRequesters, PushSeconds * 1000.0, HeapGrantsPerSecond, LegacyGrantsPerSecond,
+				HeapGrantsPerSecond / FMath::Max(LegacyGrantsPerSecond, 1e-9));
+		}
+	}
+
+	void RunFastForward(const TArray<FString>& Args, UWorld* World)
+	{
+		UTurnManagerSubsystem* TurnManager = World ? World->GetSubsystem<UTurnManagerSubsystem>() : nullptr;
+		if (!TurnManager)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("sim.FastForward: No TurnManagerSubsystem in this world"));
+			return;
+		}
+
+		const int32 NumTurns = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 100;
+		TurnManager->FastForwardTurns(NumTurns);
+	}
+
+	FAutoConsoleCommandWithWorldAndArgs FastForwardCommand(
+		TEXT("sim.FastForward"),
+		TEXT("Run territory turns back to back and report turns/sec. Usage: sim.FastForward [NumTurns] (default 100)"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&RunFastForward));
+
+	FAutoConsoleCommand BenchmarkActionQueueCommand(
+		TEXT("sim.BenchmarkActionQueue"),
+		TEXT("Measure action grant throughput. Usage: sim.BenchmarkActionQueue [RequesterCount...] (default 1000 10000 50000)"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkActionQueue));
+}
 
 void UTurnManagerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
@@ -13,6 +170,10 @@ void UTurnManagerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 	TurnDuration = 1.0f;          // Process requests every 1 second
 	TurnTimer = 0.0f;
 
+	// Adaptive action budget (starts from the fixed values above)
+	bAdaptiveActionBudget = true;
+	ActionBudget.Reset(MaxSimultaneousActions, TurnDuration);
+
 	// Territory turn system
 	TerritoryTurnDuration = 60.0f;  // 60 seconds = 1 day
 	TerritoryTurnTimer = 0.0f;
@@ -22,17 +183,27 @@ void UTurnManagerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 	bTurnPaused = false;
 	bAutoPauseEnabled = true; // Default: pause before each turn
 	bTurnReady = false;
+	bFastForwarding = false;
+
+	// Time-sliced turns
+	TurnSliceBudgetMs = 2.0f;
+
+	// Turn pipeline: built-in territory systems (other systems register through GetTurnPipeline)
+	TerritorySystems.Register(TurnPipeline);
 
 	UE_LOG(LogTemp, Log, TEXT("TurnManagerSubsystem initialized"));
-	UE_LOG(LogTemp, Log, TEXT("  Villager Actions: Max %d, Duration %.2f sec"),
-		MaxSimultaneousActions, TurnDuration);
+	UE_LOG(LogTemp, Log, TEXT("  Villager Actions: Max %d, Duration %.2f sec (adaptive %d-%d slots, target %.1f ms)"),
+		MaxSimultaneousActions, TurnDuration, ActionBudget.MinSlots, ActionBudget.MaxSlots, ActionBudget.TargetFrameMs);
 	UE_LOG(LogTemp, Log, TEXT("  Territory Turns: Duration %.0f sec (1 day)"),
 		TerritoryTurnDuration);
 	UE_LOG(LogTemp, Log, TEXT("  Auto-pause: %s"), bAutoPauseEnabled ? TEXT("Enabled") : TEXT("Disabled"));
+	UE_LOG(LogTemp, Log, TEXT("  Turn slice budget: %.1f ms/frame"), TurnSliceBudgetMs);
 }
 
 void UTurnManagerSubsystem::Deinitialize()
 {
+	TurnPipeline.Reset();
+	TerritorySystems.Reset();
 	PendingRequests.Empty();
 	ActiveActors.Empty();
 	RegisteredTerritories.Empty();
@@ -42,7 +213,12 @@ void UTurnManagerSubsystem::Deinitialize()
 
 void UTurnManagerSubsystem::Tick(float DeltaTime)
 {
-	// Process villager action requests every 1 second
+	// Game thread work of the last frame for the action budget (excludes vsync and
+	// frame rate limiter waits); fall back to real frame time before it is measured
+	const double GameThreadSeconds = FPlatformTime::ToSeconds(GGameThreadTime);
+	ActionBudget.AddFrame(GameThreadSeconds > 0.0 ? GameThreadSeconds : FApp::GetDeltaTime());
+
+	// Process villager action requests every TurnDuration seconds
 	TurnTimer += DeltaTime;
 	if (TurnTimer >= TurnDuration)
 	{
@@ -50,8 +226,16 @@ void UTurnManagerSubsystem::Tick(float DeltaTime)
 		ProcessActionRequests();
 	}
 
-	// Process territory turns every 60 seconds (1 day)
-	if (!bTurnPaused)
+	// Continue a turn that is being resolved across frames
+	if (TurnPipeline.IsRunning())
+	{
+		if (TurnPipeline.Step(TurnSliceBudgetMs / 1000.0))
+		{
+			LogTurnComplete();
+		}
+	}
+	// Process territory turns every 60 seconds (1 day), timer waits while a turn resolves
+	else if (!bTurnPaused)
 	{
 		TerritoryTurnTimer += DeltaTime;
 
@@ -74,7 +258,7 @@ void UTurnManagerSubsystem::Tick(float DeltaTime)
 			else
 			{
 				// No pause - execute turn immediately
-				ProcessTerritoryTurns();
+				StartTerritoryTurn();
 			}
 		}
 	}
@@ -91,13 +275,10 @@ void UTurnManagerSubsystem::RequestAction(ABaseVillager* Actor, EActionType Acti
 		return;
 
 	// Check if actor already has pending request
-	for (const FActionRequest& Request : PendingRequests)
+	if (PendingRequests.Contains(Actor))
 	{
-		if (Request.RequestingActor == Actor)
-		{
-			UE_LOG(LogTemp, Verbose, TEXT("%s already has pending request"), *Actor->GetName());
-			return;
-		}
+		UE_LOG(LogTemp, Verbose, TEXT("%s already has pending request"), *Actor->GetName());
+		return;
 	}
 
 	// Check if actor is already active
@@ -114,10 +295,9 @@ void UTurnManagerSubsystem::RequestAction(ABaseVillager* Actor, EActionType Acti
 	NewRequest.SocialClass = SocialClass;
 	NewRequest.Priority = CalculatePriority(SocialClass, ActionType);
 
-	PendingRequests.Add(NewRequest);
+	PendingRequests.Push(NewRequest);
 
-	UE_LOG(LogTemp, Warning, TEXT("TurnManager REQUEST: %s - Action: %d, Priority: %.2f"),
-		*Actor->GetName(), (int32)ActionType, NewRequest.Priority);
+	SIM_TRACE(Actions, ActionRequested, Actor, ActionType, SocialClass, NewRequest.Priority);
 }
 
 void UTurnManagerSubsystem::NotifyActionComplete(ABaseVillager* Actor)
@@ -127,65 +307,84 @@ void UTurnManagerSubsystem::NotifyActionComplete(ABaseVillager* Actor)
 
 	ActiveActors.Remove(Actor);
 
-	UE_LOG(LogTemp, Warning, TEXT("TurnManager COMPLETE: %s - Active actors: %d"),
-		*Actor->GetName(), ActiveActors.Num());
+	SIM_TRACE(Actions, ActionCompleted, Actor, ActiveActors.Num(), 0, 0.0f);
 }
 
 void UTurnManagerSubsystem::ProcessActionRequests()
 {
+	// Free slots held by villagers destroyed mid-action
+	for (auto It = ActiveActors.CreateIterator(); It; ++It)
+	{
+		if (!IsValid(*It))
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	UpdateActionBudget();
+
 	if (PendingRequests.Num() == 0)
 		return;
 
-	UE_LOG(LogTemp, Warning, TEXT("TurnManager PROCESSING: %d requests - Active: %d/%d"),
-		PendingRequests.Num(), ActiveActors.Num(), MaxSimultaneousActions);
-
 	GrantActionPermissions();
 }
 
-void UTurnManagerSubsystem::GrantActionPermissions()
+void UTurnManagerSubsystem::CancelActorRequests(ABaseVillager* Actor)
 {
-	// Sort requests by priority
-	SortRequestsByPriority();
+	if (!Actor)
+		return;
 
+	PendingRequests.Remove(Actor);
+	ActiveActors.Remove(Actor);
+}
+
+void UTurnManagerSubsystem::GrantActionPermissions()
+{
 	int32 GrantedCount = 0;
 	int32 AvailableSlots = MaxSimultaneousActions - ActiveActors.Num();
 
 	// Grant permission to highest priority actors
-	for (int32 i = PendingRequests.Num() - 1; i >= 0 && GrantedCount < AvailableSlots; i--)
+	FActionRequest Request;
+	while (GrantedCount < AvailableSlots && PendingRequests.Pop(Request))
 	{
-		FActionRequest& Request = PendingRequests[i];
-
-		if (Request.RequestingActor)
-		{
-			// Grant permission - actor will start their action
-			ActiveActors.Add(Request.RequestingActor);
+		if (!IsValid(Request.RequestingActor))
+			continue;
 
-			// Notify actor to start their action
-			Request.RequestingActor->OnActionPermissionGranted(Request.ActionType);
+		// Grant permission - actor will start their action
+		ActiveActors.Add(Request.RequestingActor);
 
-			UE_LOG(LogTemp, Warning, TEXT("TurnManager GRANTED: %s - Action: %d, Priority: %.2f"),
-				*Request.RequestingActor->GetName(), (int32)Request.ActionType, Request.Priority);
+		// Notify actor to start their action
+		const double GrantStartTime = FPlatformTime::Seconds();
+		Request.RequestingActor->OnActionPermissionGranted(Request.ActionType);
+		ActionBudget.AddActionCost(FPlatformTime::Seconds() - GrantStartTime);
 
-			GrantedCount++;
-		}
+		SIM_TRACE(Actions, ActionGranted, Request.RequestingActor, Request.ActionType, ActiveActors.Num(), Request.Priority);
 
-		// Remove from pending queue
-		PendingRequests.RemoveAt(i);
+		GrantedCount++;
 	}
 
-	if (GrantedCount > 0)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("TurnManager SUMMARY: Granted %d actions - Active: %d/%d, Remaining: %d"),
-			GrantedCount, ActiveActors.Num(), MaxSimultaneousActions, PendingRequests.Num());
-	}
+	SIM_TRACE(Actions, GrantCycle, nullptr, GrantedCount, PendingRequests.Num(), MaxSimultaneousActions);
 }
 
-void UTurnManagerSubsystem::SortRequestsByPriority()
+void UTurnManagerSubsystem::UpdateActionBudget()
 {
-	PendingRequests.Sort([](const FActionRequest& A, const FActionRequest& B)
+	if (bAdaptiveActionBudget)
 	{
-		return A.Priority < B.Priority;  // Ascending (lowest first, we pop from back)
-	});
+		ActionBudget.Update(ActiveActors.Num(), PendingRequests.Num());
+		MaxSimultaneousActions = ActionBudget.GetSlots();
+		TurnDuration = ActionBudget.GetInterval();
+	}
+
+	SET_DWORD_STAT(STAT_ActionSlots, MaxSimultaneousActions);
+	SET_DWORD_STAT(STAT_ActionSlotsMin, ActionBudget.MinSlots);
+	SET_DWORD_STAT(STAT_ActionSlotsMax, ActionBudget.MaxSlots);
+	SET_DWORD_STAT(STAT_ActiveActions, ActiveActors.Num());
+	SET_DWORD_STAT(STAT_PendingRequests, PendingRequests.Num());
+	SET_FLOAT_STAT(STAT_GrantInterval, TurnDuration);
+	SET_FLOAT_STAT(STAT_BudgetFrameMs, ActionBudget.GetFrameMs());
+	SET_FLOAT_STAT(STAT_BudgetTargetFrameMs, ActionBudget.TargetFrameMs);
+	SET_FLOAT_STAT(STAT_BudgetActionMs, ActionBudget.GetActionMs());
+	SET_FLOAT_STAT(STAT_BudgetCostPerActionMs, ActionBudget.GetCostPerActionMs());
 }
 
 float UTurnManagerSubsystem::CalculatePriority(ESocialClass SocialClass, EActionType ActionType)
@@ -240,7 +439,7 @@ float UTurnManagerSubsystem::CalculatePriority(ESocialClass SocialClass, EAction
 	}
 
 	// Add random factor for variation
-	float RandomFactor = FMath::RandRange(0.0f, 0.5f);
+	float RandomFactor = USimulationRandomSubsystem::GetWorldStream(this, TEXT("TurnManager")).FRandRange(0.0f, 0.5f);
 
 	return (BasePriority * ActionWeight) + RandomFactor;
 }
@@ -286,25 +485,94 @@ void UTurnManagerSubsystem::ProcessTerritoryTurns()
 	if (RegisteredTerritories.Num() == 0)
 		return;
 
+	FinishResolvingTurn();
+
+	BeginTurnPipeline();
+	TurnPipeline.Step(0.0);
+
+	LogTurnComplete();
+}
+
+void UTurnManagerSubsystem::BeginTurnPipeline()
+{
 	CurrentTurn++;
+	LogTurnBegin();
+
+	TArray<ATerritory*> Territories;
+	GatherTerritories(Territories);
+
+	TerritorySystems.BeginTurn(Territories, GetZoneGrid());
+	TurnPipeline.Begin(CurrentTurn);
+}
+
+void UTurnManagerSubsystem::StartTerritoryTurn()
+{
+	if (RegisteredTerritories.Num() == 0)
+		return;
+
+	FinishResolvingTurn();
+
+	if (TurnSliceBudgetMs <= 0.0f || bFastForwarding)
+	{
+		ProcessTerritoryTurns();
+		return;
+	}
+
+	BeginTurnPipeline();
+
+	// First slice runs this frame, the rest in Tick
+	if (TurnPipeline.Step(TurnSliceBudgetMs / 1000.0))
+	{
+		LogTurnComplete();
+	}
+}
+
+void UTurnManagerSubsystem::FinishResolvingTurn()
+{
+	if (!TurnPipeline.IsRunning())
+		return;
+
+	TurnPipeline.Step(0.0);
+	LogTurnComplete();
+}
+
+void UTurnManagerSubsystem::LogTurnBegin() const
+{
+	if (bFastForwarding)
+		return;
 
 	UE_LOG(LogTemp, Warning, TEXT("======================================"));
 	UE_LOG(LogTemp, Warning, TEXT("TURN %d BEGINNING - Processing %d territories"),
 		CurrentTurn, RegisteredTerritories.Num());
 	UE_LOG(LogTemp, Warning, TEXT("======================================"));
+}
 
-	// Process each territory's turn
+void UTurnManagerSubsystem::LogTurnComplete() const
+{
+	if (bFastForwarding)
+		return;
+
+	UE_LOG(LogTemp, Warning, TEXT("======================================"));
+	UE_LOG(LogTemp, Warning, TEXT("TURN %d COMPLETE"), CurrentTurn);
+	UE_LOG(LogTemp, Warning, TEXT("======================================"));
+}
+
+void UTurnManagerSubsystem::GatherTerritories(TArray<ATerritory*>& OutTerritories) const
+{
+	OutTerritories.Reset(RegisteredTerritories.Num());
 	for (ATerritory* Territory : RegisteredTerritories)
 	{
 		if (Territory)
 		{
-			Territory->ProcessTurn();
+			OutTerritories.Add(Territory);
 		}
 	}
+}
 
-	UE_LOG(LogTemp, Warning, TEXT("======================================"));
-	UE_LOG(LogTemp, Warning, TEXT("TURN %d COMPLETE"), CurrentTurn);
-	UE_LOG(LogTemp, Warning, TEXT("======================================"));
+AZoneGrid* UTurnManagerSubsystem::GetZoneGrid() const
+{
+	UZoneManagerSubsystem* ZoneManager = GetWorld()->GetSubsystem<UZoneManagerSubsystem>();
+	return ZoneManager ? ZoneManager->GetZoneGrid() : nullptr;
 }
 
 // === Turn Pause System ===
@@ -329,7 +597,7 @@ void UTurnManagerSubsystem::ResumeTurn()
 	bTurnPaused = false;
 	bTurnReady = false;
 
-	ProcessTerritoryTurns();
+	StartTerritoryTurn();
 }
 
 void UTurnManagerSubsystem::SetAutoPause(bool bEnabled)
@@ -346,3 +614,104 @@ void UTurnManagerSubsystem::SetAutoPause(bool bEnabled)
 		ResumeTurn();
 	}
 }
+
+// === Fast-Forward ===
+
+float UTurnManagerSubsystem::FastForwardTurns(int32 NumTurns)
+{
+	if (NumTurns <= 0 || bFastForwarding)
+		return 0.0f;
+
+	if (RegisteredTerritories.Num() == 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("TurnManager: Cannot fast-forward - no territories registered"));
+		return 0.0f;
+	}
+
+	// A turn already resolving is finished first
+	FinishResolvingTurn();
+
+	// A turn waiting on the player counts as the first fast-forwarded turn
+	bTurnPaused = false;
+	bTurnReady = false;
+	TerritoryTurnTimer = 0.0f;
+
+	const int32 StartTurn = CurrentTurn;
+	bFastForwarding = true;
+
+#if !NO_LOGGING
+	// Per-territory production/consumption logs dominate turn cost; keep errors only
+	// (their own category, so unrelated LogTemp output is untouched)
+	const ELogVerbosity::Type PreviousVerbosity = LogTerritoryTurn.GetVerbosity();
+	const ELogVerbosity::Type PreviousPipelineVerbosity = LogTurnPipeline.GetVerbosity();
+	LogTerritoryTurn.SetVerbosity(ELogVerbosity::Error);
+	LogTurnPipeline.SetVerbosity(ELogVerbosity::Error);
+#endif
+
+	const double StartTime = FPlatformTime::Seconds();
+	for (int32 Turn = 0; Turn < NumTurns; Turn++)
+	{
+		ProcessTerritoryTurns();
+	}
+	const double ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
+
+#if !NO_LOGGING
+	LogTerritoryTurn.SetVerbosity(PreviousVerbosity);
+	LogTurnPipeline.SetVerbosity(PreviousPipelineVerbosity);
+#endif
+
+	bFastForwarding = false;
+
+	const float TurnsPerSecond = static_cast<float>(NumTurns / FMath::Max(ElapsedSeconds, 1e-6));
+	UE_LOG(LogTemp, Display, TEXT("TurnManager: Fast-forwarded turns %d-%d (%d territories) in %.3f sec - %.1f turns/sec"),
+		StartTurn + 1, CurrentTurn, RegisteredTerritories.Num(), ElapsedSeconds, TurnsPerSecond);
+
+	return TurnsPerSecond;
+}
+
+
+// === Time-Sliced Turns ===
+
+void UTurnManagerSubsystem::SetTurnSliceBudget(float BudgetMs)
+{
+	TurnSliceBudgetMs = FMath::Max(BudgetMs, 0.0f);
+
+	UE_LOG(LogTemp, Log, TEXT("TurnManager: Turn slice budget %.1f ms/frame%s"),
+		TurnSliceBudgetMs, TurnSliceBudgetMs > 0.0f ? TEXT("") : TEXT(" (disabled)"));
+}
+
+// === Adaptive Action Budget ===
+
+void UTurnManagerSubsystem::SetAdaptiveActionBudget(bool bEnabled)
+{
+	bAdaptiveActionBudget = bEnabled;
+
+	if (!bEnabled)
+	{
+		// Back to the fixed defaults
+		MaxSimultaneousActions = 10;
+		TurnDuration = 1.0f;
+	}
+
+	ActionBudget.Reset(MaxSimultaneousActions, TurnDuration);
+
+	UE_LOG(LogTemp, Log, TEXT("TurnManager: Adaptive action budget %s"),
+		bEnabled ? TEXT("ENABLED") : TEXT("DISABLED"));
+}
+
+void UTurnManagerSubsystem::SetTargetFrameTime(float FrameMs)
+{
+	ActionBudget.TargetFrameMs = FMath::Max(FrameMs, 1.0f);
+}
+
+void UTurnManagerSubsystem::SetActionSlotLimits(int32 MinSlots, int32 MaxSlots)
+{
+	ActionBudget.MinSlots = FMath::Max(MinSlots, 1);
+	ActionBudget.MaxSlots = FMath::Max(MaxSlots, ActionBudget.MinSlots);
+	ActionBudget.Reset(MaxSimultaneousActions, TurnDuration);
+
+	if (bAdaptiveActionBudget)
+	{
+		MaxSimultaneousActions = ActionBudget.GetSlots();
+	}
+}
@@ -5,39 +5,19 @@
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
 #include "SimulatorTypes.h"
+#include "ActionRequestQueue.h"
+#include "TurnPipeline.h"
+#include "TerritoryTurnSystems.h"
+#include "ActionBudgetController.h"
 #include "TurnManagerSubsystem.generated.h"
 
-/**
- * Action request from an actor
- */
-USTRUCT(BlueprintType)
-struct FActionRequest
-{
-	GENERATED_BODY()
-
-	UPROPERTY()
-	class ABaseVillager* RequestingActor;
-
-	UPROPERTY()
-	EActionType ActionType;
-
-	UPROPERTY()
-	ESocialClass SocialClass;
-
-	UPROPERTY()
-	float Priority;
-
-	FActionRequest()
-		: RequestingActor(nullptr)
-		, ActionType(EActionType::None)
-		, SocialClass(ESocialClass::Peasant)
-		, Priority(0.0f)
-	{}
-};
-
 /**
  * Manages turn-based action system as a WorldSubsystem
  * Actors request actions, manager grants permission based on priority
+ *
+ * Pending requests live in an indexed priority queue and active actors in a
+ * set, so request, grant and completion are O(log n) regardless of how many
+ * villagers are waiting (see sim.BenchmarkActionQueue).
  */
 UCLASS()
 class SIMULATOR_API UTurnManagerSubsystem : public UTickableWorldSubsystem
@@ -61,6 +41,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Turn Manager")
 	void NotifyActionComplete(class ABaseVillager* Actor);
 
+	// Drop an actor's pending request and active slot (called from ABaseVillager::EndPlay)
+	UFUNCTION(BlueprintCallable, Category = "Turn Manager")
+	void CancelActorRequests(class ABaseVillager* Actor);
+
 	// Get current active actor count
 	UFUNCTION(BlueprintCallable, Category = "Turn Manager")
 	int32 GetActiveActorCount() const { return ActiveActors.Num(); }
@@ -87,6 +71,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Turn Manager|Territory")
 	int32 GetTerritoryCount() const { return RegisteredTerritories.Num(); }
 
+	// Get all registered territories
+	const TArray<class ATerritory*>& GetRegisteredTerritories() const { return RegisteredTerritories; }
+
 	// === Turn Pause System ===
 
 	// Is the turn system paused (waiting for player input)?
@@ -105,18 +92,102 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Turn Manager|Pause")
 	bool IsAutoPauseEnabled() const { return bAutoPauseEnabled; }
 
+	// === Fast-Forward ===
+
+	// Run territory turns back to back, ignoring the turn timer and auto-pause
+	// LogTerritoryTurn and LogTurnPipeline are muted to errors while running. Returns turns per second.
+	UFUNCTION(BlueprintCallable, Category = "Turn Manager|Fast Forward")
+	float FastForwardTurns(int32 NumTurns);
+
+	// Is a fast-forward batch running?
+	UFUNCTION(BlueprintCallable, Category = "Turn Manager|Fast Forward")
+	bool IsFastForwarding() const { return bFastForwarding; }
+
+	// === Adaptive Action Budget ===
+
+	// Record time spent on behalf of an active villager (AI, steering, tick)
+	void ReportActionCost(double Seconds) { ActionBudget.AddActionCost(Seconds); }
+
+	// Current number of simultaneous action slots
+	UFUNCTION(BlueprintCallable, Category = "Turn Manager|Action Budget")
+	int32 GetMaxSimultaneousActions() const { return MaxSimultaneousActions; }
+
+	// Current interval between action grant cycles (seconds)
+	UFUNCTION(BlueprintCallable, Category = "Turn Manager|Action Budget")
+	float GetActionGrantInterval() const { return TurnDuration; }
+
+	// Resize slots and grant interval from measured frame cost (off = fixed 10 slots every 1 sec)
+	UFUNCTION(BlueprintCallable, Category = "Turn Manager|Action Budget")
+	void SetAdaptiveActionBudget(bool bEnabled);
+
+	UFUNCTION(BlueprintCallable, Category = "Turn Manager|Action Budget")
+	bool IsAdaptiveActionBudgetEnabled() const { return bAdaptiveActionBudget; }
+
+	// Game thread frame time the adaptive budget aims for (ms, actions are sized to leave headroom below it)
+	UFUNCTION(BlueprintCallable, Category = "Turn Manager|Action Budget")
+	void SetTargetFrameTime(float FrameMs);
+
+	// Slot limits for the adaptive budget
+	UFUNCTION(BlueprintCallable, Category = "Turn Manager|Action Budget")
+	void SetActionSlotLimits(int32 MinSlots, int32 MaxSlots);
+
+	// === Time-Sliced Turns ===
+
+	// Is a territory turn being resolved over several frames?
+	UFUNCTION(BlueprintCallable, Category = "Turn Manager|Time Slicing")
+	bool IsTurnResolving() const { return TurnPipeline.IsRunning(); }
+
+	// Progress of the turn being resolved (0.0 - 1.0)
+	UFUNCTION(BlueprintCallable, Category = "Turn Manager|Time Slicing")
+	float GetTurnResolveProgress() const { return TurnPipeline.GetProgress(); }
+
+	// Milliseconds per frame spent resolving a territory turn (0 = whole turn in one frame)
+	UFUNCTION(BlueprintCallable, Category = "Turn Manager|Time Slicing")
+	void SetTurnSliceBudget(float BudgetMs);
+
+	UFUNCTION(BlueprintCallable, Category = "Turn Manager|Time Slicing")
+	float GetTurnSliceBudget() const { return TurnSliceBudgetMs; }
+
+	// === Turn Pipeline ===
+
+	// Phases and systems of a territory turn (register systems here, not while a turn is resolving)
+	FTurnPipeline& GetTurnPipeline() { return TurnPipeline; }
+
+	// Time a phase took in the last completed turn (ms)
+	UFUNCTION(BlueprintCallable, Category = "Turn Manager|Pipeline")
+	float GetLastTurnPhaseTime(ETurnPhase Phase) const { return TurnPipeline.GetLastPhaseMs(Phase); }
+
 protected:
 	// Process pending action requests
 	void ProcessActionRequests();
 
-	// Process territory turns (production/consumption)
+	// Process territory turns (production/consumption) in one go
 	void ProcessTerritoryTurns();
 
+	// Start the next territory turn - time-sliced if a budget is set, otherwise all at once
+	void StartTerritoryTurn();
+
+	// Advance the turn counter and start the pipeline for it
+	void BeginTurnPipeline();
+
+	// Finish a time-sliced turn in progress immediately
+	void FinishResolvingTurn();
+
+	// Turn banners (skipped while fast-forwarding)
+	void LogTurnBegin() const;
+	void LogTurnComplete() const;
+
+	// Valid registered territories, in registration order
+	void GatherTerritories(TArray<ATerritory*>& OutTerritories) const;
+
+	// Zone grid of this world (nullptr if none)
+	class AZoneGrid* GetZoneGrid() const;
+
 	// Grant action permission to highest priority actors
 	void GrantActionPermissions();
 
-	// Sort requests by priority
-	void SortRequestsByPriority();
+	// Close the action budget cycle and apply the new slots/interval
+	void UpdateActionBudget();
 
 	// Calculate priority for an action request
 	float CalculatePriority(ESocialClass SocialClass, EActionType ActionType);
@@ -124,13 +195,13 @@ protected:
 private:
 	// === Villager Action System ===
 
-	// Pending action requests (queue)
+	// Pending action requests (max-heap by priority)
 	UPROPERTY()
-	TArray<FActionRequest> PendingRequests;
+	FActionRequestQueue PendingRequests;
 
 	// Currently active actors
 	UPROPERTY()
-	TArray<class ABaseVillager*> ActiveActors;
+	TSet<class ABaseVillager*> ActiveActors;
 
 	// Maximum number of actors that can act simultaneously
 	int32 MaxSimultaneousActions;
@@ -166,4 +237,27 @@ private:
 
 	// Turn is ready to execute (timer expired, waiting for resume)
 	bool bTurnReady;
+
+	// === Fast-Forward ===
+
+	// Running FastForwardTurns (skips per-turn banners)
+	bool bFastForwarding;
+
+	// === Adaptive Action Budget ===
+
+	// Sizes MaxSimultaneousActions and TurnDuration each grant cycle
+	FActionBudgetController ActionBudget;
+
+	bool bAdaptiveActionBudget;
+
+	// === Turn Pipeline ===
+
+	// Territory turn phases (resolved across frames when TurnSliceBudgetMs > 0)
+	FTurnPipeline TurnPipeline;
+
+	// Built-in production/consumption/training/decay systems
+	FTerritoryTurnSystems TerritorySystems;
+
+	// Frame budget for resolving a turn (ms, 0 = no slicing)
+	float TurnSliceBudgetMs;
 };
@@ -0,0 +1,400 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "TurnPipeline.h"
+#include "Async/ParallelFor.h"
+
+DECLARE_CYCLE_STAT(TEXT("Phase: Production"), STAT_TurnPhase_Production, STATGROUP_TurnManager);
+DECLARE_CYCLE_STAT(TEXT("Phase: Consumption"), STAT_TurnPhase_Consumption, STATGROUP_TurnManager);
+DECLARE_CYCLE_STAT(TEXT("Phase: Training"), STAT_TurnPhase_Training, STATGROUP_TurnManager);
+DECLARE_CYCLE_STAT(TEXT("Phase: Recruitment"), STAT_TurnPhase_Recruitment, STATGROUP_TurnManager);
+DECLARE_CYCLE_STAT(TEXT("Phase: Trade Settlement"), STAT_TurnPhase_TradeSettlement, STATGROUP_TurnManager);
+DECLARE_CYCLE_STAT(TEXT("Phase: Combat Resolution"), STAT_TurnPhase_CombatResolution, STATGROUP_TurnManager);
+DECLARE_CYCLE_STAT(TEXT("Phase: Decay"), STAT_TurnPhase_Decay, STATGROUP_TurnManager);
+
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Last Turn Production (ms)"), STAT_TurnPhaseMs_Production, STATGROUP_TurnManager);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Last Turn Consumption (ms)"), STAT_TurnPhaseMs_Consumption, STATGROUP_TurnManager);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Last Turn Training (ms)"), STAT_TurnPhaseMs_Training, STATGROUP_TurnManager);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Last Turn Recruitment (ms)"), STAT_TurnPhaseMs_Recruitment, STATGROUP_TurnManager);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Last Turn Trade Settlement (ms)"), STAT_TurnPhaseMs_TradeSettlement, STATGROUP_TurnManager);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Last Turn Combat Resolution (ms)"), STAT_TurnPhaseMs_CombatResolution, STATGROUP_TurnManager);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Last Turn Decay (ms)"), STAT_TurnPhaseMs_Decay, STATGROUP_TurnManager);
+
+DEFINE_LOG_CATEGORY(LogTurnPipeline);
+
+namespace
+{
+	TStatId GetPhaseStatId(ETurnPhase Phase)
+	{
+		switch (Phase)
+		{
+		case ETurnPhase::Production:		return GET_STATID(STAT_TurnPhase_Production);
+		case ETurnPhase::Consumption:		return GET_STATID(STAT_TurnPhase_Consumption);
+		case ETurnPhase::Training:			return GET_STATID(STAT_TurnPhase_Training);
+		case ETurnPhase::Recruitment:		return GET_STATID(STAT_TurnPhase_Recruitment);
+		case ETurnPhase::TradeSettlement:	return GET_STATID(STAT_TurnPhase_TradeSettlement);
+		case ETurnPhase::CombatResolution:	return GET_STATID(STAT_TurnPhase_CombatResolution);
+		default:							return GET_STATID(STAT_TurnPhase_Decay);
+		}
+	}
+
+	void SetPhaseMsStat(ETurnPhase Phase, float Ms)
+	{
+		switch (Phase)
+		{
+		case ETurnPhase::Production:		SET_FLOAT_STAT(STAT_TurnPhaseMs_Production, Ms); break;
+		case ETurnPhase::Consumption:		SET_FLOAT_STAT(STAT_TurnPhaseMs_Consumption, Ms); break;
+		case ETurnPhase::Training:			SET_FLOAT_STAT(STAT_TurnPhaseMs_Training, Ms); break;
+		case ETurnPhase::Recruitment:		SET_FLOAT_STAT(STAT_TurnPhaseMs_Recruitment, Ms); break;
+		case ETurnPhase::TradeSettlement:	SET_FLOAT_STAT(STAT_TurnPhaseMs_TradeSettlement, Ms); break;
+		case ETurnPhase::CombatResolution:	SET_FLOAT_STAT(STAT_TurnPhaseMs_CombatResolution, Ms); break;
+		default:							SET_FLOAT_STAT(STAT_TurnPhaseMs_Decay, Ms); break;
+		}
+	}
+}
+
+FTurnPipeline::FTurnPipeline()
+{
+	// Default: strictly sequential phases
+	for (int32 Phase = 0; Phase < NumTurnPhases; ++Phase)
+	{
+		PhaseDependencies[Phase] = Phase > 0 ? (1u << (Phase - 1)) : 0;
+		PhaseSeconds[Phase] = 0.0;
+		LastPhaseMs[Phase] = 0.0f;
+	}
+}
+
+bool FTurnPipeline::RegisterSystem(FTurnSystem System)
+{
+	check(!bRunning);
+
+	if (!System.Execute || System.Phase == ETurnPhase::Count)
+		return false;
+
+	if (Systems.ContainsByPredicate([&System](const FTurnSystem& Existing) { return Existing.Name == System.Name; }))
+	{
+		UE_LOG(LogTurnPipeline, Warning, TEXT("TurnPipeline: System %s already registered"), *System.Name.ToString());
+		return false;
+	}
+
+	UE_LOG(LogTurnPipeline, Verbose, TEXT("TurnPipeline: Registered %s in phase %s"), *System.Name.ToString(), GetPhaseName(System.Phase));
+
+	Systems.Add(MoveTemp(System));
+	bScheduleDirty = true;
+	return true;
+}
+
+bool FTurnPipeline::UnregisterSystem(FName Name)
+{
+	check(!bRunning);
+
+	const int32 Removed = Systems.RemoveAll([Name](const FTurnSystem& System) { return System.Name == Name; });
+	bScheduleDirty |= Removed > 0;
+	return Removed > 0;
+}
+
+void FTurnPipeline::SetPhaseDependencies(ETurnPhase Phase, const TArray<ETurnPhase>& DependsOn)
+{
+	check(!bRunning);
+
+	uint32 Mask = 0;
+	for (ETurnPhase Dependency : DependsOn)
+	{
+		if (Dependency != Phase && Dependency != ETurnPhase::Count)
+		{
+			Mask |= 1u << static_cast<int32>(Dependency);
+		}
+	}
+
+	PhaseDependencies[static_cast<int32>(Phase)] = Mask;
+	bScheduleDirty = true;
+}
+
+void FTurnPipeline::BuildSchedule()
+{
+	// Systems inside each phase: registration order, then pull dependencies forward (Kahn's algorithm)
+	for (int32 Phase = 0; Phase < NumTurnPhases; ++Phase)
+	{
+		TArray<int32> Pending;
+		for (int32 Index = 0; Index < Systems.Num(); ++Index)
+		{
+			if (static_cast<int32>(Systems[Index].Phase) == Phase)
+			{
+				Pending.Add(Index);
+			}
+		}
+
+		TArray<int32>& Order = PhaseOrder[Phase];
+		Order.Reset();
+
+		while (Pending.Num() > 0)
+		{
+			int32 ReadyIndex = INDEX_NONE;
+			for (int32 Candidate = 0; Candidate < Pending.Num() && ReadyIndex == INDEX_NONE; ++Candidate)
+			{
+				bool bReady = true;
+				for (FName Dependency : Systems[Pending[Candidate]].RunAfter)
+				{
+					if (Pending.ContainsByPredicate([this, Dependency](int32 Other) { return Systems[Other].Name == Dependency; }))
+					{
+						bReady = false;
+						break;
+					}
+				}
+
+				if (bReady)
+				{
+					ReadyIndex = Candidate;
+				}
+			}
+
+			if (ReadyIndex == INDEX_NONE)
+			{
+				UE_LOG(LogTurnPipeline, Error, TEXT("TurnPipeline: Dependency cycle in phase %s, running remaining systems in registration order"),
+					GetPhaseName(static_cast<ETurnPhase>(Phase)));
+				Order.Append(Pending);
+				break;
+			}
+
+			Order.Add(Pending[ReadyIndex]);
+			Pending.RemoveAt(ReadyIndex);
+		}
+	}
+
+	// Phases: each wave holds the phases whose dependencies are all in earlier waves
+	Waves.Reset();
+	uint32 DoneMask = 0;
+	const uint32 AllMask = (1u << NumTurnPhases) - 1;
+	while (DoneMask != AllMask)
+	{
+		TArray<ETurnPhase>& Wave = Waves.AddDefaulted_GetRef();
+		for (int32 Phase = 0; Phase < NumTurnPhases; ++Phase)
+		{
+			if ((DoneMask & (1u << Phase)) == 0 && (PhaseDependencies[Phase] & ~DoneMask) == 0)
+			{
+				Wave.Add(static_cast<ETurnPhase>(Phase));
+			}
+		}
+
+		if (Wave.Num() == 0)
+		{
+			UE_LOG(LogTurnPipeline, Error, TEXT("TurnPipeline: Phase dependency cycle, running remaining phases in declaration order"));
+			for (int32 Phase = 0; Phase < NumTurnPhases; ++Phase)
+			{
+				if ((DoneMask & (1u << Phase)) == 0)
+				{
+					Wave.Add(static_cast<ETurnPhase>(Phase));
+				}
+			}
+		}
+
+		for (ETurnPhase Phase : Wave)
+		{
+			DoneMask |= 1u << static_cast<int32>(Phase);
+		}
+	}
+
+	bScheduleDirty = false;
+}
+
+void FTurnPipeline::Begin(int32 Turn)
+{
+	if (bScheduleDirty)
+	{
+		BuildSchedule();
+	}
+
+	CurrentTurn = Turn;
+	WaveIndex = 0;
+	WavePhaseIndex = 0;
+	PhaseSystemIndex = 0;
+	SystemProgress = 0.0f;
+	CompletedSystems = 0;
+	for (double& Seconds : PhaseSeconds)
+	{
+		Seconds = 0.0;
+	}
+
+	bRunning = true;
+}
+
+bool FTurnPipeline::Step(double BudgetSeconds)
+{
+	if (!bRunning)
+		return true;
+
+	FTurnPhaseContext Context;
+	Context.Turn = CurrentTurn;
+	Context.Deadline = BudgetSeconds > 0.0 ? FPlatformTime::Seconds() + BudgetSeconds : 0.0;
+
+	while (WaveIndex < Waves.Num())
+	{
+		if (!Context.IsTimeSliced() && TryRunWaveConcurrently())
+			continue;
+
+		const ETurnPhase Phase = Waves[WaveIndex][WavePhaseIndex];
+		const TArray<int32>& Order = PhaseOrder[static_cast<int32>(Phase)];
+
+		if (Order.IsValidIndex(PhaseSystemIndex))
+		{
+			Context.Progress = SystemProgress;
+			if (!RunSystem(Order[PhaseSystemIndex], Context))
+			{
+				// Out of time mid-system, resume here next slice
+				SystemProgress = FMath::Clamp(Context.Progress, 0.0f, 1.0f);
+				return false;
+			}
+
+			CompletedSystems++;
+		}
+
+		Advance();
+
+		if (WaveIndex < Waves.Num() && !Context.HasTimeLeft())
+			return false;
+	}
+
+	FinishTurn();
+	return true;
+}
+
+bool FTurnPipeline::RunSystem(int32 SystemIndex, FTurnPhaseContext& Context)
+{
+	FTurnSystem& System = Systems[SystemIndex];
+	const int32 PhaseIndex = static_cast<int32>(System.Phase);
+
+	FScopeCycleCounter CycleCounter(GetPhaseStatId(System.Phase));
+	const double StartTime = FPlatformTime::Seconds();
+
+	const bool bDone = System.Execute(Context);
+
+	PhaseSeconds[PhaseIndex] += FPlatformTime::Seconds() - StartTime;
+	return bDone;
+}
+
+bool FTurnPipeline::TryRunWaveConcurrently()
+{
+	if (WavePhaseIndex != 0 || PhaseSystemIndex != 0)
+		return false;
+
+	const TArray<ETurnPhase>& Wave = Waves[WaveIndex];
+
+	// Only worth it with two or more phases that have work, all of it thread-safe
+	int32 PhasesWithWork = 0;
+	for (ETurnPhase Phase : Wave)
+	{
+		const TArray<int32>& Order = PhaseOrder[static_cast<int32>(Phase)];
+		for (int32 SystemIndex : Order)
+		{
+			if (!Systems[SystemIndex].bThreadSafe)
+				return false;
+		}
+		PhasesWithWork += Order.Num() > 0 ? 1 : 0;
+	}
+
+	if (PhasesWithWork < 2)
+		return false;
+
+	// Each phase accumulates into its own PhaseSeconds slot, so no shared writes
+	ParallelFor(Wave.Num(), [this, &Wave](int32 Index)
+	{
+		FTurnPhaseContext Context;
+		Context.Turn = CurrentTurn;
+
+		for (int32 SystemIndex : PhaseOrder[static_cast<int32>(Wave[Index])])
+		{
+			RunSystem(SystemIndex, Context);
+		}
+	});
+
+	for (ETurnPhase Phase : Wave)
+	{
+		CompletedSystems += PhaseOrder[static_cast<int32>(Phase)].Num();
+	}
+
+	WaveIndex++;
+	return true;
+}
+
+void FTurnPipeline::Advance()
+{
+	SystemProgress = 0.0f;
+
+	const ETurnPhase Phase = Waves[WaveIndex][WavePhaseIndex];
+	if (++PhaseSystemIndex < PhaseOrder[static_cast<int32>(Phase)].Num())
+		return;
+
+	PhaseSystemIndex = 0;
+	if (++WavePhaseIndex < Waves[WaveIndex].Num())
+		return;
+
+	WavePhaseIndex = 0;
+	WaveIndex++;
+}
+
+void FTurnPipeline::FinishTurn()
+{
+	bRunning = false;
+
+	for (int32 Phase = 0; Phase < NumTurnPhases; ++Phase)
+	{
+		LastPhaseMs[Phase] = static_cast<float>(PhaseSeconds[Phase] * 1000.0);
+		SetPhaseMsStat(static_cast<ETurnPhase>(Phase), LastPhaseMs[Phase]);
+	}
+
+#if !NO_LOGGING
+	// Readable summary for debugging only; the numbers are always available via stat TurnManager and GetLastPhaseMs
+	if (UE_LOG_ACTIVE(LogTurnPipeline, Verbose))
+	{
+		FString Summary;
+		for (int32 Phase = 0; Phase < NumTurnPhases; ++Phase)
+		{
+			if (PhaseOrder[Phase].Num() > 0)
+			{
+				Summary += FString::Printf(TEXT("%s%s %.2f ms"), Summary.IsEmpty() ? TEXT("") : TEXT(", "),
+					GetPhaseName(static_cast<ETurnPhase>(Phase)), LastPhaseMs[Phase]);
+			}
+		}
+
+		UE_LOG(LogTurnPipeline, Verbose, TEXT("TurnPipeline: Turn %d phases - %s"), CurrentTurn, *Summary);
+	}
+#endif
+}
+
+void FTurnPipeline::Reset()
+{
+	bRunning = false;
+	WaveIndex = 0;
+	WavePhaseIndex = 0;
+	PhaseSystemIndex = 0;
+	SystemProgress = 0.0f;
+	CompletedSystems = 0;
+}
+
+float FTurnPipeline::GetProgress() const
+{
+	if (!bRunning)
+		return 1.0f;
+
+	int32 TotalSystems = 0;
+	for (const TArray<int32>& Order : PhaseOrder)
+	{
+		TotalSystems += Order.Num();
+	}
+
+	return TotalSystems > 0 ? FMath::Clamp((CompletedSystems + SystemProgress) / TotalSystems, 0.0f, 1.0f) : 0.0f;
+}
+
+const TCHAR* FTurnPipeline::GetPhaseName(ETurnPhase Phase)
+{
+	switch (Phase)
+	{
+	case ETurnPhase::Production:		return TEXT("Production");
+	case ETurnPhase::Consumption:		return TEXT("Consumption");
+	case ETurnPhase::Training:			return TEXT("Training");
+	case ETurnPhase::Recruitment:		return TEXT("Recruitment");
+	case ETurnPhase::TradeSettlement:	return TEXT("TradeSettlement");
+	case ETurnPhase::CombatResolution:	return TEXT("CombatResolution");
+	case ETurnPhase::Decay:				return TEXT("Decay");
+	default:							return TEXT("Unknown");
+	}
+}
@@ -0,0 +1,162 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "HAL/PlatformTime.h"
+#include "TurnPipeline.generated.h"
+
+DECLARE_STATS_GROUP(TEXT("TurnManager"), STATGROUP_TurnManager, STATCAT_Advanced);
+
+// Pipeline setup and per-turn phase summaries (timings are published as TurnManager stats)
+SIMULATOR_API DECLARE_LOG_CATEGORY_EXTERN(LogTurnPipeline, Log, All);
+
+/**
+ * Territory turn phases (default order: each phase runs after the previous one)
+ */
+UENUM(BlueprintType)
+enum class ETurnPhase : uint8
+{
+	Production          UMETA(DisplayName = "Production"),          // Buildings produce, inputs consumed
+	Consumption         UMETA(DisplayName = "Consumption"),         // Population upkeep
+	Training            UMETA(DisplayName = "Training"),            // Guild training queues
+	Recruitment         UMETA(DisplayName = "Recruitment"),         // Barracks recruitment
+	TradeSettlement     UMETA(DisplayName = "Trade Settlement"),    // Trade deliveries
+	CombatResolution    UMETA(DisplayName = "Combat Resolution"),   // Battles
+	Decay               UMETA(DisplayName = "Decay"),               // Zone resource depletion/regrowth
+	Count               UMETA(Hidden)
+};
+
+constexpr int32 NumTurnPhases = static_cast<int32>(ETurnPhase::Count);
+
+/**
+ * Passed to a turn system each time it runs
+ */
+struct FTurnPhaseContext
+{
+	int32 Turn = 0;
+
+	// FPlatformTime::Seconds() at which the current slice ends (0 = no limit, run to completion)
+	double Deadline = 0.0;
+
+	// Set by resumable systems: fraction of their work done (0.0 - 1.0)
+	float Progress = 0.0f;
+
+	bool IsTimeSliced() const { return Deadline > 0.0; }
+
+	bool HasTimeLeft() const { return Deadline <= 0.0 || FPlatformTime::Seconds() < Deadline; }
+};
+
+/**
+ * A unit of turn work registered into a phase
+ */
+struct FTurnSystem
+{
+	FName Name;
+
+	ETurnPhase Phase = ETurnPhase::Production;
+
+	// Systems of the same phase that must finish first
+	TArray<FName> RunAfter;
+
+	// May run on a worker thread while other independent phases run
+	bool bThreadSafe = false;
+
+	// Do (part of) this turn's work. Return true when done, false to be resumed in the next slice.
+	// Time-sliced calls should stop once Context.HasTimeLeft() is false; unsliced calls must finish.
+	TFunction<bool(FTurnPhaseContext&)> Execute;
+};
+
+/**
+ * Declarative territory turn pipeline
+ * Systems register into named phases; within a phase they run in
+ * registration order, adjusted so every system runs after its RunAfter
+ * entries. Phases run in dependency order (by default each phase depends
+ * on the one before it).
+ *
+ * - Step() with a budget resumes where the last slice stopped
+ * - Without a budget, phases whose dependencies are met at the same time
+ *   run concurrently when all their systems are thread-safe
+ * - Time spent per phase is tracked per turn and published as stats
+ *   ("stat TurnManager")
+ */
+class SIMULATOR_API FTurnPipeline
+{
+public:
+	FTurnPipeline();
+
+	// Add a system (false if the name is taken or Execute is unset)
+	bool RegisterSystem(FTurnSystem System);
+
+	bool UnregisterSystem(FName Name);
+
+	// Phases that must complete before Phase starts
+	void SetPhaseDependencies(ETurnPhase Phase, const TArray<ETurnPhase>& DependsOn);
+
+	// Start a turn
+	void Begin(int32 Turn);
+
+	// Run systems until the budget is spent (<= 0 = run to completion). Returns true once the turn is done.
+	bool Step(double BudgetSeconds);
+
+	// Abandon a turn in progress
+	void Reset();
+
+	bool IsRunning() const { return bRunning; }
+
+	// Fraction of the turn's systems done (0.0 - 1.0)
+	float GetProgress() const;
+
+	// Time the phase took in the last completed turn (ms, summed over slices)
+	float GetLastPhaseMs(ETurnPhase Phase) const { return LastPhaseMs[static_cast<int32>(Phase)]; }
+
+	static const TCHAR* GetPhaseName(ETurnPhase Phase);
+
+private:
+	// Order systems inside each phase and group phases into dependency waves
+	void BuildSchedule();
+
+	// Run the system at the cursor once; true if it finished
+	bool RunSystem(int32 SystemIndex, FTurnPhaseContext& Context);
+
+	// Run a whole wave with its phases in parallel (only called unsliced at a wave boundary)
+	bool TryRunWaveConcurrently();
+
+	// Move the cursor past the current system
+	void Advance();
+
+	// Publish phase timings of the finished turn
+	void FinishTurn();
+
+	TArray<FTurnSystem> Systems;
+
+	// Bit i set = phase depends on phase i
+	uint32 PhaseDependencies[NumTurnPhases];
+
+	// Systems of each phase in run order (indices into Systems)
+	TArray<int32> PhaseOrder[NumTurnPhases];
+
+	// Phases grouped by dependency level
+	TArray<TArray<ETurnPhase>> Waves;
+
+	bool bScheduleDirty = true;
+
+	// === Turn in progress ===
+
+	bool bRunning = false;
+	int32 CurrentTurn = 0;
+
+	// Cursor: wave, phase within the wave, system within the phase
+	int32 WaveIndex = 0;
+	int32 WavePhaseIndex = 0;
+	int32 PhaseSystemIndex = 0;
+
+	// Progress reported by the system at the cursor
+	float SystemProgress = 0.0f;
+
+	int32 CompletedSystems = 0;
+
+	double PhaseSeconds[NumTurnPhases];
+	float LastPhaseMs[NumTurnPhases];
+};
@@ -10,35 +10,36 @@
 #include "EngineUtils.h"
 #include "TimerManager.h"
 
+namespace
+{
+	// Bucket ids: one per EVillagerRole, then one per ESocialClass
+	constexpr int32 SocialClassBucketOffset = NumVillagerRoles;
+	constexpr int32 NumVillagerBuckets = SocialClassBucketOffset + NumSocialClasses;
+}
+
 void UVillagerManagerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
 
-	RefreshInterval = 10.0f; // Refresh every 10 seconds
+	AssignRetryInterval = 10.0f; // Retry every 10 seconds
 	bAutoAssignOnStart = true;
 
-	// Initial refresh
-	RefreshVillagerList();
+	// Villagers fill the registry from their own BeginPlay
+	Villagers.SetNumBuckets(NumVillagerBuckets);
 
-	// Auto-assign if enabled
-	if (bAutoAssignOnStart)
-	{
-		AutoAssignAll();
-	}
-
-	// Set up periodic refresh
-	if (RefreshInterval > 0.0f && GetWorld())
+	// Set up periodic assignment retries (walks the registry, not the world)
+	if (AssignRetryInterval > 0.0f && GetWorld())
 	{
 		GetWorld()->GetTimerManager().SetTimer(
-			RefreshTimerHandle,
+			AssignRetryTimerHandle,
 			this,
-			&UVillagerManagerSubsystem::PeriodicRefresh,
-			RefreshInterval,
+			&UVillagerManagerSubsystem::RetryPendingAssignments,
+			AssignRetryInterval,
 			true
 		);
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("VillagerManagerSubsystem initialized - Total population: %d"), AllVillagers.Num());
+	UE_LOG(LogTemp, Log, TEXT("VillagerManagerSubsystem initialized"));
 }
 
 void UVillagerManagerSubsystem::Deinitialize()
@@ -46,44 +47,103 @@ void UVillagerManagerSubsystem::Deinitialize()
 	// Clear timer
 	if (GetWorld())
 	{
-		GetWorld()->GetTimerManager().ClearTimer(RefreshTimerHandle);
+		GetWorld()->GetTimerManager().ClearTimer(AssignRetryTimerHandle);
 	}
 
-	AllVillagers.Empty();
+	Villagers.Reset();
 
 	Super::Deinitialize();
 }
 
-void UVillagerManagerSubsystem::RefreshVillagerList()
+void UVillagerManagerSubsystem::OnWorldBeginPlay(UWorld& InWorld)
 {
-	AllVillagers.Empty();
+	Super::OnWorldBeginPlay(InWorld);
+
+	// Level actors (villagers and houses) register during BeginPlay, which runs after this
+	if (bAutoAssignOnStart)
+	{
+		InWorld.GetTimerManager().SetTimerForNextTick(this, &UVillagerManagerSubsystem::AutoAssignAll);
+	}
+}
 
+void UVillagerManagerSubsystem::RefreshVillagerList()
+{
 	if (!GetWorld())
 	{
 		return;
 	}
 
 	// Find all villagers in the world
+	TArray<ABaseVillager*> WorldVillagers;
 	for (TActorIterator<ABaseVillager> It(GetWorld()); It; ++It)
 	{
 		ABaseVillager* Villager = *It;
-		if (Villager)
+		if (IsValid(Villager))
 		{
-			AllVillagers.Add(Villager);
+			WorldVillagers.Add(Villager);
 		}
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("VillagerManagerSubsystem: Refreshed villager list - Found %d villagers"), AllVillagers.Num());
+	TArray<ABaseVillager*> MissingVillagers;
+	TArray<ABaseVillager*> StaleVillagers;
+	Villagers.FindDrift(WorldVillagers, MissingVillagers, StaleVillagers);
+
+	for (ABaseVillager* Villager : StaleVillagers)
+	{
+		Villagers.Remove(Villager);
+	}
+	for (ABaseVillager* Villager : MissingVillagers)
+	{
+		RegisterVillager(Villager);
+	}
+
+	// Anything found here skipped BeginPlay/EndPlay registration
+	UE_LOG(LogTemp, Log, TEXT("VillagerManagerSubsystem: Resynced villager list - %d villagers"), Villagers.Num());
+	UE_CLOG(MissingVillagers.Num() + StaleVillagers.Num() > 0, LogTemp, Warning,
+		TEXT("VillagerManagerSubsystem: Registry was out of sync - %d missing / %d stale"),
+		MissingVillagers.Num(), StaleVillagers.Num());
+}
+
+TArray<int32, TInlineAllocator<2>> UVillagerManagerSubsystem::GetBucketIds(const ABaseVillager* Villager)
+{
+	return { static_cast<int32>(Villager->VillagerRole), SocialClassBucketOffset + static_cast<int32>(Villager->SocialClass) };
+}
+
+void UVillagerManagerSubsystem::RegisterVillager(ABaseVillager* Villager)
+{
+	if (Villager && !Villagers.Contains(Villager))
+	{
+		Villagers.Add(Villager, GetBucketIds(Villager));
+		UE_LOG(LogTemp, Verbose, TEXT("VillagerManagerSubsystem: Registered villager %s (Total: %d)"),
+			*Villager->VillagerName, Villagers.Num());
+	}
+}
+
+void UVillagerManagerSubsystem::UnregisterVillager(ABaseVillager* Villager)
+{
+	if (Villager && Villagers.Remove(Villager))
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("VillagerManagerSubsystem: Unregistered villager %s (Total: %d)"),
+			*Villager->VillagerName, Villagers.Num());
+	}
+}
+
+void UVillagerManagerSubsystem::UpdateVillagerBuckets(ABaseVillager* Villager)
+{
+	if (Villager)
+	{
+		Villagers.SetBuckets(Villager, GetBucketIds(Villager));
+	}
 }
 
 void UVillagerManagerSubsystem::AutoAssignAll()
 {
-	UE_LOG(LogTemp, Log, TEXT("VillagerManagerSubsystem: Starting auto-assignment for %d villagers"), AllVillagers.Num());
+	UE_LOG(LogTemp, Log, TEXT("VillagerManagerSubsystem: Starting auto-assignment for %d villagers"), Villagers.Num());
 
 	int32 HomesAssigned = 0;
 	int32 WorkZonesAssigned = 0;
 
-	for (ABaseVillager* Villager : AllVillagers)
+	for (ABaseVillager* Villager : Villagers.GetAll())
 	{
 		if (!Villager)
 			continue;
@@ -124,14 +184,11 @@ bool UVillagerManagerSubsystem::AutoAssignHome(ABaseVillager* Villager)
 		return false;
 	}
 
-	// Get all houses
-	TArray<ABaseBuilding*> Buildings = BuildingManager->GetBuildingsByType(EBuildingType::House);
-
 	// Find nearest available house
 	AHouse* BestHouse = nullptr;
 	float BestDistance = FLT_MAX;
 
-	for (ABaseBuilding* Building : Buildings)
+	for (ABaseBuilding* Building : BuildingManager->GetBuildingsByTypeView(EBuildingType::House))
 	{
 		AHouse* House = Cast<AHouse>(Building);
 		if (House && House->HasAvailableSpace())
@@ -168,14 +225,11 @@ bool UVillagerManagerSubsystem::AutoAssignWorkZone(ABaseVillager* Villager)
 		if (!BuildingManager)
 			return false;
 
-		// Get workshops matching specialty
-		TArray<ABaseBuilding*> Buildings = BuildingManager->GetBuildingsByType(Craftsman->Specialty);
-
-		// Find nearest available workshop
+		// Find nearest available workshop matching specialty
 		ABaseBuilding* BestWorkshop = nullptr;
 		float BestDistance = FLT_MAX;
 
-		for (ABaseBuilding* Building : Buildings)
+		for (ABaseBuilding* Building : BuildingManager->GetBuildingsByTypeView(Craftsman->Specialty))
 		{
 			if (Building && Building->HasAvailableWorkerSlots())
 			{
@@ -261,41 +315,39 @@ bool UVillagerManagerSubsystem::AutoAssignWorkZone(ABaseVillager* Villager)
 	return false;
 }
 
-TArray<ABaseVillager*> UVillagerManagerSubsystem::GetVillagersByRole(EVillagerRole VillagerRole) const
+TArray<ABaseVillager*> UVillagerManagerSubsystem::GetAllVillagers() const
 {
-	TArray<ABaseVillager*> Result;
+	TConstArrayView<ABaseVillager*> View = GetAllVillagersView();
+	return TArray<ABaseVillager*>(View.GetData(), View.Num());
+}
 
-	for (ABaseVillager* Villager : AllVillagers)
-	{
-		if (Villager && Villager->VillagerRole == VillagerRole)
-		{
-			Result.Add(Villager);
-		}
-	}
+TArray<ABaseVillager*> UVillagerManagerSubsystem::GetVillagersByRole(EVillagerRole VillagerRole) const
+{
+	TConstArrayView<ABaseVillager*> View = GetVillagersByRoleView(VillagerRole);
+	return TArray<ABaseVillager*>(View.GetData(), View.Num());
+}
 
-	return Result;
+TConstArrayView<ABaseVillager*> UVillagerManagerSubsystem::GetVillagersByRoleView(EVillagerRole VillagerRole) const
+{
+	return Villagers.GetBucket(static_cast<int32>(VillagerRole));
 }
 
 TArray<ABaseVillager*> UVillagerManagerSubsystem::GetVillagersBySocialClass(ESocialClass VillagerSocialClass) const
 {
-	TArray<ABaseVillager*> Result;
-
-	for (ABaseVillager* Villager : AllVillagers)
-	{
-		if (Villager && Villager->SocialClass == VillagerSocialClass)
-		{
-			Result.Add(Villager);
-		}
-	}
+	TConstArrayView<ABaseVillager*> View = GetVillagersBySocialClassView(VillagerSocialClass);
+	return TArray<ABaseVillager*>(View.GetData(), View.Num());
+}
 
-	return Result;
+TConstArrayView<ABaseVillager*> UVillagerManagerSubsystem::GetVillagersBySocialClassView(ESocialClass VillagerSocialClass) const
+{
+	return Villagers.GetBucket(SocialClassBucketOffset + static_cast<int32>(VillagerSocialClass));
 }
 
 TArray<ABaseVillager*> UVillagerManagerSubsystem::GetHomelessVillagers() const
 {
 	TArray<ABaseVillager*> Result;
 
-	for (ABaseVillager* Villager : AllVillagers)
+	for (ABaseVillager* Villager : Villagers.GetAll())
 	{
 		if (Villager && !Villager->AssignedHome)
 		{
@@ -310,7 +362,7 @@ TArray<ABaseVillager*> UVillagerManagerSubsystem::GetUnemployedVillagers() const
 {
 	TArray<ABaseVillager*> Result;
 
-	for (ABaseVillager* Villager : AllVillagers)
+	for (ABaseVillager* Villager : Villagers.GetAll())
 	{
 		if (!Villager)
 			continue;
@@ -332,17 +384,7 @@ TArray<ABaseVillager*> UVillagerManagerSubsystem::GetUnemployedVillagers() const
 
 int32 UVillagerManagerSubsystem::GetPopulationByRole(EVillagerRole VillagerRole) const
 {
-	int32 Count = 0;
-
-	for (ABaseVillager* Villager : AllVillagers)
-	{
-		if (Villager && Villager->VillagerRole == VillagerRole)
-		{
-			Count++;
-		}
-	}
-
-	return Count;
+	return Villagers.NumInBucket(static_cast<int32>(VillagerRole));
 }
 
 int32 UVillagerManagerSubsystem::GetHomelessCount() const
@@ -355,12 +397,10 @@ int32 UVillagerManagerSubsystem::GetUnemployedCount() const
 	return GetUnemployedVillagers().Num();
 }
 
-void UVillagerManagerSubsystem::PeriodicRefresh()
+void UVillagerManagerSubsystem::RetryPendingAssignments()
 {
-	RefreshVillagerList();
-
 	// Auto-assign any new unassigned villagers
-	for (ABaseVillager* Villager : AllVillagers)
+	for (ABaseVillager* Villager : Villagers.GetAll())
 	{
 		if (!Villager)
 			continue;
@@ -5,12 +5,17 @@
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
 #include "SimulatorTypes.h"
+#include "ActorRegistry.h"
 #include "VillagerManagerSubsystem.generated.h"
 
 /**
  * Manager for all villagers in the world as a WorldSubsystem
  * Handles automatic assignment of homes and work zones
  * Tracks population statistics and manages villager lifecycle
+ *
+ * Villagers register themselves in BeginPlay and unregister in EndPlay,
+ * bucketed by role and by social class; the *View accessors return those
+ * buckets without allocating.
  */
 UCLASS()
 class SIMULATOR_API UVillagerManagerSubsystem : public UWorldSubsystem
@@ -21,11 +26,30 @@ public:
 	// USubsystem implementation
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 	virtual void Deinitialize() override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
 
-	// Refresh the list of all villagers in the world
+	// Full resync with the world's villagers (debug only - registration keeps the list current)
 	UFUNCTION(BlueprintCallable, Category = "Villager Manager")
 	void RefreshVillagerList();
 
+	// Register a villager (called from ABaseVillager::BeginPlay; repeated calls are ignored)
+	UFUNCTION(BlueprintCallable, Category = "Villager Manager")
+	void RegisterVillager(class ABaseVillager* Villager);
+
+	// Unregister a villager (called from ABaseVillager::EndPlay)
+	UFUNCTION(BlueprintCallable, Category = "Villager Manager")
+	void UnregisterVillager(class ABaseVillager* Villager);
+
+	// Re-bucket a villager after changing its VillagerRole or SocialClass
+	UFUNCTION(BlueprintCallable, Category = "Villager Manager")
+	void UpdateVillagerBuckets(class ABaseVillager* Villager);
+
+	// Stable handle for a registered villager (invalid if not registered)
+	FActorRegistryHandle GetVillagerHandle(const class ABaseVillager* Villager) const { return Villagers.FindHandle(Villager); }
+
+	// Villager for a handle (nullptr once it has unregistered)
+	class ABaseVillager* ResolveVillagerHandle(const FActorRegistryHandle& Handle) const { return Villagers.Resolve(Handle); }
+
 	// Auto-assign homes and work zones to all villagers
 	UFUNCTION(BlueprintCallable, Category = "Villager Manager")
 	void AutoAssignAll();
@@ -38,18 +62,27 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Villager Manager")
 	bool AutoAssignWorkZone(class ABaseVillager* Villager);
 
-	// Get all villagers
+	// Get all villagers (allocates - C++ callers should use GetAllVillagersView)
 	UFUNCTION(BlueprintCallable, Category = "Villager Manager")
-	TArray<class ABaseVillager*> GetAllVillagers() const { return AllVillagers; }
+	TArray<class ABaseVillager*> GetAllVillagers() const;
+
+	// All villagers (invalidated when a villager registers or unregisters)
+	TConstArrayView<class ABaseVillager*> GetAllVillagersView() const { return Villagers.GetAll(); }
 
-	// Get villagers by role
+	// Get villagers by role (allocates - C++ callers should use GetVillagersByRoleView)
 	UFUNCTION(BlueprintCallable, Category = "Villager Manager")
 	TArray<class ABaseVillager*> GetVillagersByRole(EVillagerRole VillagerRole) const;
 
-	// Get villagers by social class
+	// Villagers with a role (invalidated when a villager registers, unregisters or is re-bucketed)
+	TConstArrayView<class ABaseVillager*> GetVillagersByRoleView(EVillagerRole VillagerRole) const;
+
+	// Get villagers by social class (allocates - C++ callers should use GetVillagersBySocialClassView)
 	UFUNCTION(BlueprintCallable, Category = "Villager Manager")
 	TArray<class ABaseVillager*> GetVillagersBySocialClass(ESocialClass VillagerSocialClass) const;
 
+	// Villagers of a social class (invalidated when a villager registers, unregisters or is re-bucketed)
+	TConstArrayView<class ABaseVillager*> GetVillagersBySocialClassView(ESocialClass VillagerSocialClass) const;
+
 	// Get homeless villagers
 	UFUNCTION(BlueprintCallable, Category = "Villager Manager")
 	TArray<class ABaseVillager*> GetHomelessVillagers() const;
@@ -60,7 +93,7 @@ public:
 
 	// Get population statistics
 	UFUNCTION(BlueprintCallable, Category = "Villager Manager")
-	int32 GetTotalPopulation() const { return AllVillagers.Num(); }
+	int32 GetTotalPopulation() const { return Villagers.Num(); }
 
 	UFUNCTION(BlueprintCallable, Category = "Villager Manager")
 	int32 GetPopulationByRole(EVillagerRole VillagerRole) const;
@@ -72,19 +105,21 @@ public:
 	int32 GetUnemployedCount() const;
 
 protected:
-	// Cache of all villagers in the world
-	UPROPERTY()
-	TArray<class ABaseVillager*> AllVillagers;
+	// Every registered villager, bucketed by role and social class
+	TActorRegistry<class ABaseVillager> Villagers;
+
+	// Bucket ids for a villager's current role and social class
+	static TArray<int32, TInlineAllocator<2>> GetBucketIds(const class ABaseVillager* Villager);
 
-	// How often to refresh the villager list (in seconds)
-	float RefreshInterval;
+	// How often to retry assignment for villagers without a home or work (in seconds)
+	float AssignRetryInterval;
 
-	// Should auto-assign on initialization?
+	// Should auto-assign once the level's actors have begun play?
 	bool bAutoAssignOnStart;
 
-	// Timer for periodic refresh
-	FTimerHandle RefreshTimerHandle;
+	// Timer for periodic assignment retries
+	FTimerHandle AssignRetryTimerHandle;
 
-	// Periodic refresh function
-	void PeriodicRefresh();
+	// Assign homes/work to registered villagers that still lack them
+	void RetryPendingAssignments();
 };
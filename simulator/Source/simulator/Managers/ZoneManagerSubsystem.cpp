@@ -27,6 +27,22 @@ void UZoneManagerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 	}
 }
 
+void UZoneManagerSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// A zone grid spawned or streamed in after initialization
+	if (!CachedZoneGrid)
+	{
+		for (TActorIterator<AZoneGrid> It(&InWorld); It; ++It)
+		{
+			CachedZoneGrid = *It;
+			UE_LOG(LogTemp, Log, TEXT("ZoneManagerSubsystem: Found ZoneGrid at begin play (%d cells)"), CachedZoneGrid->GetTotalCells());
+			break;
+		}
+	}
+}
+
 void UZoneManagerSubsystem::Deinitialize()
 {
 	CachedZoneGrid = nullptr;
@@ -47,3 +63,13 @@ ETerrainZone UZoneManagerSubsystem::GetZoneTypeAtLocation(FVector Location) cons
 
 	return ETerrainZone::Farmland; // Default
 }
+
+bool UZoneManagerSubsystem::FindNearestZoneLocation(FVector FromLocation, ETerrainZone ZoneType, FVector& OutLocation) const
+{
+	if (CachedZoneGrid)
+	{
+		return CachedZoneGrid->FindNearestZoneCell(FromLocation, ZoneType, OutLocation);
+	}
+
+	return false;
+}
@@ -23,6 +23,7 @@ public:
 	// USubsystem implementation
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 	virtual void Deinitialize() override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
 
 	// Get zone grid in world
 	UFUNCTION(BlueprintCallable, Category = "Zone Manager")
@@ -32,6 +33,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Zone Manager")
 	ETerrainZone GetZoneTypeAtLocation(FVector Location) const;
 
+	// Find nearest cell center of zone type (uses ZoneGrid nearest-zone fields)
+	UFUNCTION(BlueprintCallable, Category = "Zone Manager")
+	bool FindNearestZoneLocation(FVector FromLocation, ETerrainZone ZoneType, FVector& OutLocation) const;
+
 protected:
 	// Cached zone grid reference
 	UPROPERTY()
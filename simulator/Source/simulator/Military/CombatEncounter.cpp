@@ -462,13 +462,13 @@ void ACombatEncounter::LootDefeatedCaravans()
 		}
 
 		// 패배한 상단 약탈 (50% 약탈)
-		TMap<EResourceType, int32> LootedResources = Caravan->GetLooted(0.5f);
+		FResourceVector LootedResources = Caravan->GetLooted(0.5f);
 
 		UE_LOG(LogTemp, Warning, TEXT("Caravan looted! Attacker gained:"));
-		for (const auto& Pair : LootedResources)
+		for (const FResourceStack& Stack : LootedResources)
 		{
 			UE_LOG(LogTemp, Warning, TEXT("  - %d %s"),
-				Pair.Value, *UEnum::GetValueAsString(Pair.Key));
+				Stack.Quantity, *UEnum::GetValueAsString(Stack.ResourceType));
 		}
 
 		// TODO: 약탈한 자원을 승자에게 전달
@@ -4,6 +4,8 @@
 #include "SoldierVillager.h"
 #include "AIController.h"
 #include "CombatManagerSubsystem.h"
+#include "ZoneManagerSubsystem.h"
+#include "ZoneGrid.h"
 
 AMilitaryUnit::AMilitaryUnit()
 {
@@ -21,6 +23,7 @@ AMilitaryUnit::AMilitaryUnit()
 	TargetLocation = FVector::ZeroVector;
 	bIsMoving = false;
 	MovementSpeed = 300.0f;
+	CurrentWaypointIndex = 0;
 
 	// Combat state
 	bIsInCombat = false;
@@ -188,7 +191,19 @@ void AMilitaryUnit::MoveToLocation(FVector Location)
 	TargetLocation = Location;
 	bIsMoving = true;
 
-	UE_LOG(LogTemp, Log, TEXT("Unit %s: Moving to %s"), *UnitName, *Location.ToString());
+	// 물/산 등 통행 불가 지형을 우회하는 경로 (없으면 직선)
+	PathWaypoints.Reset();
+	CurrentWaypointIndex = 0;
+
+	UZoneManagerSubsystem* ZoneManager = GetWorld() ? GetWorld()->GetSubsystem<UZoneManagerSubsystem>() : nullptr;
+	AZoneGrid* ZoneGrid = ZoneManager ? ZoneManager->GetZoneGrid() : nullptr;
+	if (!ZoneGrid || !ZoneGrid->FindPath(FormationCenter, TargetLocation, PathWaypoints))
+	{
+		PathWaypoints.Reset();
+		PathWaypoints.Add(TargetLocation);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("Unit %s: Moving to %s (%d waypoints)"), *UnitName, *Location.ToString(), PathWaypoints.Num());
 }
 
 void AMilitaryUnit::StopMovement()
@@ -321,8 +336,17 @@ void AMilitaryUnit::UpdateMovement(float DeltaTime)
 		return;
 	}
 
-	// 부대 중심을 목표로 이동
-	FVector Direction = (TargetLocation - FormationCenter).GetSafeNormal();
+	// 중간 웨이포인트에 도달하면 다음 웨이포인트로
+	while (CurrentWaypointIndex < PathWaypoints.Num() - 1 &&
+		FVector::Dist(FormationCenter, PathWaypoints[CurrentWaypointIndex]) < FormationSpacing)
+	{
+		CurrentWaypointIndex++;
+	}
+
+	const FVector NextWaypoint = PathWaypoints.IsValidIndex(CurrentWaypointIndex) ? PathWaypoints[CurrentWaypointIndex] : TargetLocation;
+
+	// 부대 중심을 다음 웨이포인트로 이동
+	FVector Direction = (NextWaypoint - FormationCenter).GetSafeNormal();
 	FVector NewCenter = FormationCenter + (Direction * MovementSpeed * DeltaTime);
 
 	FormationCenter = NewCenter;
@@ -92,6 +92,14 @@ public:
 	UPROPERTY(BlueprintReadOnly, Category = "Movement")
 	float MovementSpeed;
 
+	// 경로 웨이포인트 (ZoneGrid 경로 탐색 결과, 마지막 = TargetLocation)
+	UPROPERTY(BlueprintReadOnly, Category = "Movement")
+	TArray<FVector> PathWaypoints;
+
+	// 현재 향하는 웨이포인트 인덱스
+	UPROPERTY(BlueprintReadOnly, Category = "Movement")
+	int32 CurrentWaypointIndex;
+
 	// === Functions ===
 
 	// 병사 추가
@@ -3,7 +3,7 @@
 #include "VillagePlayerController.h"
 #include "BaseVillager.h"
 #include "VillagerAIController.h"
-#include "Kismet/GameplayStatics.h"
+#include "VillagerManagerSubsystem.h"
 #include "Engine/World.h"
 
 AVillagePlayerController::AVillagePlayerController()
@@ -48,16 +48,18 @@ void AVillagePlayerController::OnMouseClick()
 
 void AVillagePlayerController::PossessVillagerAtLocation(FVector Location)
 {
-	// Find closest villager to location
-	TArray<AActor*> FoundVillagers;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), ABaseVillager::StaticClass(), FoundVillagers);
+	UVillagerManagerSubsystem* VillagerManager = GetWorld()->GetSubsystem<UVillagerManagerSubsystem>();
+	if (!VillagerManager)
+	{
+		return;
+	}
 
+	// Find closest villager to location
 	ABaseVillager* ClosestVillager = nullptr;
 	float ClosestDistance = FLT_MAX;
 
-	for (AActor* Actor : FoundVillagers)
+	for (ABaseVillager* Villager : VillagerManager->GetAllVillagersView())
 	{
-		ABaseVillager* Villager = Cast<ABaseVillager>(Actor);
 		if (Villager)
 		{
 			float Distance = FVector::Dist(Villager->GetActorLocation(), Location);
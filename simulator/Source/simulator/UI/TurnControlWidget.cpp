@@ -31,16 +31,20 @@ void UTurnControlWidget::UpdateTurnStatus()
 	bool bPreviousPaused = bIsPaused;
 	bool bPreviousAutoPause = bAutoPauseEnabled;
 	int32 PreviousTurn = CurrentTurn;
+	bool bPreviousResolving = bIsResolving;
 
 	bIsPaused = TurnManager->IsTurnPaused();
 	bAutoPauseEnabled = TurnManager->IsAutoPauseEnabled();
 	CurrentTurn = TurnManager->GetCurrentTurn();
 	TimeUntilNextTurn = 60.0f; // TODO: Get actual timer from TurnManager
+	bIsResolving = TurnManager->IsTurnResolving();
+	ResolveProgress = TurnManager->GetTurnResolveProgress();
 
 	// Notify Blueprint if state changed
 	if (bPreviousPaused != bIsPaused ||
 		bPreviousAutoPause != bAutoPauseEnabled ||
-		PreviousTurn != CurrentTurn)
+		PreviousTurn != CurrentTurn ||
+		bPreviousResolving != bIsResolving)
 	{
 		OnTurnStateChanged(bIsPaused, bAutoPauseEnabled, CurrentTurn);
 	}
@@ -109,3 +113,29 @@ float UTurnControlWidget::GetTurnProgressPercent() const
 	float Elapsed = TurnDuration - TimeUntilNextTurn;
 	return FMath::Clamp(Elapsed / TurnDuration, 0.0f, 1.0f);
 }
+
+bool UTurnControlWidget::IsTurnResolving() const
+{
+	return bIsResolving;
+}
+
+float UTurnControlWidget::GetTurnResolveProgress() const
+{
+	return ResolveProgress;
+}
+
+FText UTurnControlWidget::GetTurnStatusText() const
+{
+	if (bIsResolving)
+	{
+		return FText::FromString(FString::Printf(TEXT("Turn %d resolving: %d%%"),
+			CurrentTurn, FMath::FloorToInt(ResolveProgress * 100.0f)));
+	}
+
+	if (bIsPaused)
+	{
+		return FText::FromString(FString::Printf(TEXT("Turn %d - Paused"), CurrentTurn));
+	}
+
+	return FText::FromString(FString::Printf(TEXT("Turn %d"), CurrentTurn));
+}
@@ -16,6 +16,7 @@
  * 3. Bind button OnClicked events to BP functions that call these C++ functions
  * 4. Implement OnTurnStateChanged event to update button states
  * 5. Call UpdateTurnStatus() regularly (e.g., on Tick) to refresh display
+ * 6. Bind a TextBlock to GetTurnStatusText() to show "Turn N resolving: 43%"
  */
 UCLASS()
 class SIMULATOR_API UTurnControlWidget : public UUserWidget
@@ -62,6 +63,18 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Turn Control")
 	float GetTurnProgressPercent() const;
 
+	// Is the current turn still being resolved (spread over several frames)?
+	UFUNCTION(BlueprintCallable, Category = "Turn Control")
+	bool IsTurnResolving() const;
+
+	// Resolve progress of the current turn (0.0 - 1.0)
+	UFUNCTION(BlueprintCallable, Category = "Turn Control")
+	float GetTurnResolveProgress() const;
+
+	// Status line, e.g. "Turn 12 resolving: 43%" or "Turn 12 - Paused"
+	UFUNCTION(BlueprintCallable, Category = "Turn Control")
+	FText GetTurnStatusText() const;
+
 protected:
 	// Called when turn state changes (paused/resumed/turn executed)
 	UFUNCTION(BlueprintImplementableEvent, Category = "Turn Control")
@@ -83,4 +96,10 @@ protected:
 
 	UPROPERTY(BlueprintReadOnly, Category = "Turn Control")
 	float TimeUntilNextTurn;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Turn Control")
+	bool bIsResolving;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Turn Control")
+	float ResolveProgress;
 };
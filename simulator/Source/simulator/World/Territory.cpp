@@ -7,9 +7,12 @@
 #include "BaseVillager.h"
 #include "Caravan.h"
 #include "TurnManagerSubsystem.h"
+#include "SimulationRandomSubsystem.h"
 #include "GuildHall.h"
 #include "Kismet/GameplayStatics.h"
 
+DEFINE_LOG_CATEGORY(LogTerritoryTurn);
+
 ATerritory::ATerritory()
 {
 	PrimaryActorTick.bCanEverTick = true;
@@ -83,12 +86,7 @@ void ATerritory::Tick(float DeltaTime)
 
 int32 ATerritory::GetTotalResourceAmount() const
 {
-	int32 Total = 0;
-	for (const auto& Pair : TerritoryResources)
-	{
-		Total += Pair.Value;
-	}
-	return Total;
+	return TerritoryResources.GetTotal();
 }
 
 bool ATerritory::AddResource(EResourceType ResourceType, int32 Amount)
@@ -99,23 +97,18 @@ bool ATerritory::AddResource(EResourceType ResourceType, int32 Amount)
 	int32 CurrentAmount = GetTotalResourceAmount();
 	if (CurrentAmount + Amount > MaxStorageCapacity)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Territory %s: Storage capacity exceeded"),
+		UE_LOG(LogTerritoryTurn, Warning, TEXT("Territory %s: Storage capacity exceeded"),
 			*TerritoryName);
 		return false;
 	}
 
 	// 자원 추가
-	if (!TerritoryResources.Contains(ResourceType))
-	{
-		TerritoryResources.Add(ResourceType, 0);
-	}
-
-	TerritoryResources[ResourceType] += Amount;
+	int32 NewAmount = TerritoryResources.Add(ResourceType, Amount);
 
-	UE_LOG(LogTemp, Log, TEXT("Territory %s: +%d %s (Total: %d)"),
+	UE_LOG(LogTerritoryTurn, Log, TEXT("Territory %s: +%d %s (Total: %d)"),
 		*TerritoryName, Amount,
 		*UEnum::GetValueAsString(ResourceType),
-		TerritoryResources[ResourceType]);
+		NewAmount);
 
 	return true;
 }
@@ -124,30 +117,26 @@ bool ATerritory::RemoveResource(EResourceType ResourceType, int32 Amount)
 {
 	if (Amount <= 0) return false;
 
-	if (!TerritoryResources.Contains(ResourceType) || TerritoryResources[ResourceType] < Amount)
+	if (TerritoryResources.Get(ResourceType) < Amount)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Territory %s: Not enough %s to remove"),
+		UE_LOG(LogTerritoryTurn, Warning, TEXT("Territory %s: Not enough %s to remove"),
 			*TerritoryName, *UEnum::GetValueAsString(ResourceType));
 		return false;
 	}
 
-	TerritoryResources[ResourceType] -= Amount;
+	int32 Remaining = TerritoryResources.Add(ResourceType, -Amount);
 
-	UE_LOG(LogTemp, Log, TEXT("Territory %s: -%d %s (Remaining: %d)"),
+	UE_LOG(LogTerritoryTurn, Log, TEXT("Territory %s: -%d %s (Remaining: %d)"),
 		*TerritoryName, Amount,
 		*UEnum::GetValueAsString(ResourceType),
-		TerritoryResources[ResourceType]);
+		Remaining);
 
 	return true;
 }
 
 int32 ATerritory::GetResourceAmount(EResourceType ResourceType) const
 {
-	if (TerritoryResources.Contains(ResourceType))
-	{
-		return TerritoryResources[ResourceType];
-	}
-	return 0;
+	return TerritoryResources.Get(ResourceType);
 }
 
 bool ATerritory::HasResource(EResourceType ResourceType, int32 Amount) const
@@ -242,7 +231,28 @@ void ATerritory::UnregisterVillager(ABaseVillager* Villager)
 
 void ATerritory::CalculateProduction()
 {
-	ProductionPerTurn.Empty();
+	FTerritoryTurnDelta Delta;
+	ComputeProductionDelta(Delta);
+	CommitProduction(Delta);
+}
+
+void ATerritory::CalculateConsumption()
+{
+	FTerritoryTurnDelta Delta;
+	ComputeConsumptionDelta(Delta);
+	CommitConsumption(Delta);
+}
+
+void ATerritory::ComputeTurnDelta(FTerritoryTurnDelta& OutDelta) const
+{
+	ComputeProductionDelta(OutDelta);
+	ComputeConsumptionDelta(OutDelta);
+}
+
+void ATerritory::ComputeProductionDelta(FTerritoryTurnDelta& OutDelta) const
+{
+	OutDelta.BuildingOutputs.Reset();
+	OutDelta.Production.Reset();
 
 	if (TerritoryState != ETerritoryState::Owned)
 	{
@@ -250,121 +260,186 @@ void ATerritory::CalculateProduction()
 		return;
 	}
 
+	// 창고 스냅샷 - 앞 건물이 쓴 투입 자원은 뒤 건물이 쓸 수 없음 (직렬 처리와 동일)
+	FResourceVector Stock = TerritoryResources;
+
 	// Aggregate production from all buildings
 	for (ABaseBuilding* Building : Buildings)
 	{
-		if (!Building || !Building->bIsOperational || !Building->bCanProduce)
-			continue;
+		ComputeBuildingOutput(Building, Stock, OutDelta);
+	}
+}
 
-		// Get production from this building
-		TMap<EResourceType, int32> BuildingProduction = Building->CalculateProduction();
+void ATerritory::ComputeBuildingOutput(ABaseBuilding* Building, FResourceVector& Stock, FTerritoryTurnDelta& OutDelta) const
+{
+	if (!Building || !Building->bIsOperational || !Building->bCanProduce)
+		return;
+
+	FTerritoryTurnDelta::FBuildingOutput& Output = OutDelta.BuildingOutputs.AddDefaulted_GetRef();
+	Output.Building = Building;
+	Output.Efficiency = Building->CalculateLaborEfficiency();
+	Output.Production = Building->PreviewProduction(Building->OwnerTerritory ? &Stock : nullptr, Output.ConsumedInputs);
+
+	// Add to territory total
+	OutDelta.Production += Output.Production;
+}
+
+void ATerritory::ComputeConsumptionDelta(FTerritoryTurnDelta& OutDelta) const
+{
+	OutDelta.Consumption.Reset();
+
+	// 주민 1명당 식량 1 소비
+	int32 FoodConsumption = GetPopulation();
+	if (FoodConsumption > 0)
+	{
+		OutDelta.Consumption.Set(EResourceType::Food, FoodConsumption);
+	}
+}
 
-		// Add to territory total
-		for (const auto& Pair : BuildingProduction)
+void ATerritory::CommitProduction(const FTerritoryTurnDelta& Delta)
+{
+	ProductionPerTurn = Delta.Production;
+
+	for (const FTerritoryTurnDelta::FBuildingOutput& Output : Delta.BuildingOutputs)
+	{
+		// 분할 처리 중 철거된 건물 - 투입 자원을 쓰지 않았으니 산출도 없음
+		if (!IsValid(Output.Building))
 		{
-			if (!ProductionPerTurn.Contains(Pair.Key))
+			ProductionPerTurn -= Output.Production;
+			continue;
+		}
+
+		// Consume input resources from territory warehouse
+		if (ATerritory* InputTerritory = Output.Building->OwnerTerritory)
+		{
+			// 계산 이후 창고가 바뀌었을 수 있음 (분할 처리) - 지금 재고로 다시 확인하고, 부족하면 이 건물 산출 취소
+			FResourceVector Needed;
+			for (const FResourceStack& Input : Output.ConsumedInputs)
+			{
+				Needed.Add(Input.ResourceType, Input.Quantity);
+			}
+
+			if (!InputTerritory->TerritoryResources.Covers(Needed))
+			{
+				UE_LOG(LogTerritoryTurn, Log, TEXT("  %s: inputs no longer available, production dropped"), *Output.Building->BuildingName);
+				ProductionPerTurn -= Output.Production;
+				continue;
+			}
+
+			for (const FResourceStack& Input : Output.ConsumedInputs)
 			{
-				ProductionPerTurn.Add(Pair.Key, 0);
+				InputTerritory->RemoveResource(Input.ResourceType, Input.Quantity);
 			}
-			ProductionPerTurn[Pair.Key] += Pair.Value;
 		}
 
 		// Log individual building production
-		if (BuildingProduction.Num() > 0)
+		if (!Output.Production.IsEmpty())
 		{
-			float Efficiency = Building->CalculateLaborEfficiency();
-			UE_LOG(LogTemp, Log, TEXT("  %s (Workers: %d/%d, Efficiency: %.0f%%) produces:"),
-				*Building->BuildingName, Building->CurrentWorkers, Building->OptimalWorkerCount, Efficiency * 100.0f);
+			UE_LOG(LogTerritoryTurn, Log, TEXT("  %s (Workers: %d/%d, Efficiency: %.0f%%) produces:"),
+				*Output.Building->BuildingName, Output.Building->CurrentWorkers, Output.Building->OptimalWorkerCount, Output.Efficiency * 100.0f);
 
-			for (const auto& Pair : BuildingProduction)
+			for (const FResourceStack& Stack : Output.Production)
 			{
-				UE_LOG(LogTemp, Log, TEXT("    - %s: %d"),
-					*UEnum::GetValueAsString(Pair.Key), Pair.Value);
+				UE_LOG(LogTerritoryTurn, Log, TEXT("    - %s: %d"),
+					*UEnum::GetValueAsString(Stack.ResourceType), Stack.Quantity);
 			}
 		}
 	}
 
+	if (TerritoryState != ETerritoryState::Owned)
+		return;
+
 	// Log total production
-	if (ProductionPerTurn.Num() > 0)
+	if (!ProductionPerTurn.IsEmpty())
 	{
-		UE_LOG(LogTemp, Log, TEXT("Territory %s: Total production this turn:"), *TerritoryName);
-		for (const auto& Pair : ProductionPerTurn)
+		UE_LOG(LogTerritoryTurn, Log, TEXT("Territory %s: Total production this turn:"), *TerritoryName);
+		for (const FResourceStack& Stack : ProductionPerTurn)
 		{
-			UE_LOG(LogTemp, Log, TEXT("  - %s: %d"),
-				*UEnum::GetValueAsString(Pair.Key), Pair.Value);
+			UE_LOG(LogTerritoryTurn, Log, TEXT("  - %s: %d"),
+				*UEnum::GetValueAsString(Stack.ResourceType), Stack.Quantity);
 		}
 	}
 	else
 	{
-		UE_LOG(LogTemp, Log, TEXT("Territory %s: No production this turn"), *TerritoryName);
+		UE_LOG(LogTerritoryTurn, Log, TEXT("Territory %s: No production this turn"), *TerritoryName);
 	}
 }
 
-void ATerritory::CalculateConsumption()
+void ATerritory::CommitConsumption(const FTerritoryTurnDelta& Delta)
 {
-	ConsumptionPerTurn.Empty();
-
-	// 주민 1명당 식량 1 소비
-	int32 FoodConsumption = GetPopulation();
-	if (FoodConsumption > 0)
-	{
-		ConsumptionPerTurn.Add(EResourceType::Food, FoodConsumption);
-	}
+	ConsumptionPerTurn = Delta.Consumption;
 
-	UE_LOG(LogTemp, Log, TEXT("Territory %s: Consumption calculated (Food: %d)"),
-		*TerritoryName, FoodConsumption);
+	UE_LOG(LogTerritoryTurn, Log, TEXT("Territory %s: Consumption calculated (Food: %d)"),
+		*TerritoryName, ConsumptionPerTurn.Get(EResourceType::Food));
 }
 
 void ATerritory::ProcessTurn()
 {
-	UE_LOG(LogTemp, Log, TEXT("=== Territory %s: Processing Turn ==="), *TerritoryName);
-
-	// 1. 생산/소비 계산
-	CalculateProduction();
-	CalculateConsumption();
+	FTerritoryTurnDelta Delta;
+	ComputeTurnDelta(Delta);
+	ApplyTurnDelta(Delta);
+	ProcessTrainingQueues();
+}
 
-	// 2. 생산 적용
-	for (const auto& Pair : ProductionPerTurn)
+void ATerritory::ProcessTrainingQueues()
+{
+	for (ABaseBuilding* Building : Buildings)
 	{
-		AddResource(Pair.Key, Pair.Value);
+		AGuildHall* Guild = Cast<AGuildHall>(Building);
+		if (Guild && Guild->bIsTraining)
+		{
+			Guild->ProcessTrainingTurn();
+		}
 	}
+}
+
+void ATerritory::ApplyTurnDelta(const FTerritoryTurnDelta& Delta)
+{
+	ApplyProductionDelta(Delta);
+	ApplyConsumptionDelta(Delta);
+}
 
-	// 3. 소비 적용
-	for (const auto& Pair : ConsumptionPerTurn)
+void ATerritory::ApplyProductionDelta(const FTerritoryTurnDelta& Delta)
+{
+	UE_LOG(LogTerritoryTurn, Log, TEXT("=== Territory %s: Processing Turn ==="), *TerritoryName);
+
+	// 1. 생산 확정 + 적용
+	CommitProduction(Delta);
+	for (const FResourceStack& Stack : ProductionPerTurn)
 	{
-		if (!RemoveResource(Pair.Key, Pair.Value))
-		{
-			// 자원 부족 시 경고
-			UE_LOG(LogTemp, Warning, TEXT("Territory %s: Insufficient %s for consumption!"),
-				*TerritoryName, *UEnum::GetValueAsString(Pair.Key));
-		}
+		AddResource(Stack.ResourceType, Stack.Quantity);
 	}
+}
 
-	// 4. Process guild hall training (if any)
-	for (ABaseBuilding* Building : Buildings)
+void ATerritory::ApplyConsumptionDelta(const FTerritoryTurnDelta& Delta)
+{
+	// 2. 소비 확정 + 적용
+	CommitConsumption(Delta);
+	for (const FResourceStack& Stack : ConsumptionPerTurn)
 	{
-		AGuildHall* Guild = Cast<AGuildHall>(Building);
-		if (Guild && Guild->bIsTraining)
+		if (!RemoveResource(Stack.ResourceType, Stack.Quantity))
 		{
-			Guild->ProcessTrainingTurn();
+			// 자원 부족 시 경고
+			UE_LOG(LogTerritoryTurn, Warning, TEXT("Territory %s: Insufficient %s for consumption!"),
+				*TerritoryName, *UEnum::GetValueAsString(Stack.ResourceType));
 		}
 	}
 
-	// 5. 자원 상태 로그
-	UE_LOG(LogTemp, Log, TEXT("Territory %s: Resources after turn:"), *TerritoryName);
-	for (const auto& Pair : TerritoryResources)
+	// 3. 자원 상태 로그
+	UE_LOG(LogTerritoryTurn, Log, TEXT("Territory %s: Resources after turn:"), *TerritoryName);
+	for (const FResourceStack& Stack : TerritoryResources)
 	{
-		if (Pair.Value > 0)
+		if (Stack.Quantity > 0)
 		{
-			UE_LOG(LogTemp, Log, TEXT("  - %s: %d"),
-				*UEnum::GetValueAsString(Pair.Key), Pair.Value);
+			UE_LOG(LogTerritoryTurn, Log, TEXT("  - %s: %d"),
+				*UEnum::GetValueAsString(Stack.ResourceType), Stack.Quantity);
 		}
 	}
 }
 
 ACaravan* ATerritory::ExportResources(
 	ATerritory* Destination,
-	TMap<EResourceType, int32> Resources,
+	const FResourceVector& Resources,
 	int32 GuardCount)
 {
 	if (!Destination)
@@ -389,20 +464,24 @@ ACaravan* ATerritory::ExportResources(
 	}
 
 	// 자원 확인 및 인출
-	for (const auto& Pair : Resources)
+	if (!TerritoryResources.Covers(Resources))
 	{
-		if (!HasResource(Pair.Key, Pair.Value))
+		for (const FResourceStack& Stack : Resources)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("Territory %s: Not enough %s to export"),
-				*TerritoryName, *UEnum::GetValueAsString(Pair.Key));
-			return nullptr;
+			if (!HasResource(Stack.ResourceType, Stack.Quantity))
+			{
+				UE_LOG(LogTemp, Warning, TEXT("Territory %s: Not enough %s to export"),
+					*TerritoryName, *UEnum::GetValueAsString(Stack.ResourceType));
+				break;
+			}
 		}
+		return nullptr;
 	}
 
 	// 영지에서 자원 제거
-	for (const auto& Pair : Resources)
+	for (const FResourceStack& Stack : Resources)
 	{
-		RemoveResource(Pair.Key, Pair.Value);
+		RemoveResource(Stack.ResourceType, Stack.Quantity);
 	}
 
 	// 교역소를 통해 상단 파견
@@ -421,11 +500,11 @@ ACaravan* ATerritory::ExportResources(
 	return Caravan;
 }
 
-void ATerritory::ImportResources(TMap<EResourceType, int32> Resources)
+void ATerritory::ImportResources(const FResourceVector& Resources)
 {
-	for (const auto& Pair : Resources)
+	for (const FResourceStack& Stack : Resources)
 	{
-		AddResource(Pair.Key, Pair.Value);
+		AddResource(Stack.ResourceType, Stack.Quantity);
 	}
 
 	UE_LOG(LogTemp, Log, TEXT("Territory %s: Resources imported"), *TerritoryName);
@@ -477,12 +556,12 @@ void ATerritory::ProcessNeutralDecay(float DeltaTime)
 		return;
 
 	// Decay resources
-	for (auto& Pair : TerritoryResources)
+	int32 Decay = FMath::RoundToInt(NeutralResourceDecayRate * DeltaTime);
+	for (const FResourceStack& Stack : TerritoryResources)
 	{
-		if (Pair.Value > 0)
+		if (Stack.Quantity > 0)
 		{
-			int32 Decay = FMath::RoundToInt(NeutralResourceDecayRate * DeltaTime);
-			Pair.Value = FMath::Max(0, Pair.Value - Decay);
+			TerritoryResources.Set(Stack.ResourceType, FMath::Max(0, Stack.Quantity - Decay));
 		}
 	}
 
@@ -490,10 +569,14 @@ void ATerritory::ProcessNeutralDecay(float DeltaTime)
 	if (Villagers.Num() > 0)
 	{
 		float PopDecay = NeutralPopulationDecayRate * DeltaTime;
-		if (FMath::FRand() < PopDecay)
+		USimulationRandomSubsystem* Random = GetWorld()->GetSubsystem<USimulationRandomSubsystem>();
+		FSimRandomStream& RandomStream = Random ? Random->GetTerritoryStream(this)
+			: USimulationRandomSubsystem::GetWorldStream(this, TEXT("Territory"));
+
+		if (RandomStream.FRand() < PopDecay)
 		{
 			// Randomly remove a villager
-			int32 RandomIndex = FMath::RandRange(0, Villagers.Num() - 1);
+			int32 RandomIndex = RandomStream.RandRange(0, Villagers.Num() - 1);
 			ABaseVillager* VillagerToRemove = Villagers[RandomIndex];
 
 			if (VillagerToRemove)
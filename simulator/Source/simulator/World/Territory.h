@@ -7,6 +7,40 @@
 #include "SimulatorTypes.h"
 #include "Territory.generated.h"
 
+// 턴 처리 중 영지 자원/생산 로그 (빨리감기 중에는 Error만 출력)
+SIMULATOR_API DECLARE_LOG_CATEGORY_EXTERN(LogTerritoryTurn, Log, All);
+
+/**
+ * 영지 한 턴의 변화량
+ * ComputeTurnDelta가 현재 상태를 읽기만 해서 계산하고 (병렬 가능),
+ * ApplyTurnDelta가 게임 스레드에서 적용한다
+ */
+struct FTerritoryTurnDelta
+{
+	// 건물별 생산 결과 (건물 순서 유지)
+	struct FBuildingOutput
+	{
+		class ABaseBuilding* Building = nullptr;
+
+		// 노동 효율
+		float Efficiency = 0.0f;
+
+		// 영지 창고에서 차감할 투입 자원
+		TArray<FResourceStack> ConsumedInputs;
+
+		// 산출 자원
+		FResourceVector Production;
+	};
+
+	TArray<FBuildingOutput> BuildingOutputs;
+
+	// 영지 총 생산량
+	FResourceVector Production;
+
+	// 영지 총 소비량
+	FResourceVector Consumption;
+};
+
 /**
  * 영지 액터
  * 특정 지역의 자원, 건물, 주민, 생산을 통합 관리
@@ -55,9 +89,9 @@ public:
 
 	// === Resource Management ===
 
-	// 영지 자원 저장소 (중앙 집중)
+	// 영지 자원 저장소 (중앙 집중, 총량 캐시)
 	UPROPERTY(BlueprintReadOnly, Category = "Territory|Resources")
-	TMap<EResourceType, int32> TerritoryResources;
+	FResourceVector TerritoryResources;
 
 	// 최대 저장 용량
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Territory|Resources")
@@ -135,11 +169,11 @@ public:
 
 	// 턴당 자원 생산량 (건물/주민 활동 결과)
 	UPROPERTY(BlueprintReadOnly, Category = "Territory|Economy")
-	TMap<EResourceType, int32> ProductionPerTurn;
+	FResourceVector ProductionPerTurn;
 
 	// 턴당 자원 소비량 (주민 유지비)
 	UPROPERTY(BlueprintReadOnly, Category = "Territory|Economy")
-	TMap<EResourceType, int32> ConsumptionPerTurn;
+	FResourceVector ConsumptionPerTurn;
 
 	// 생산/소비 계산
 	UFUNCTION(BlueprintCallable, Category = "Territory|Economy")
@@ -152,19 +186,52 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Territory|Economy")
 	void ProcessTurn();
 
+	// 턴 변화량 계산 (상태 변경 없음 - 다른 영지와 병렬 실행 가능)
+	void ComputeTurnDelta(FTerritoryTurnDelta& OutDelta) const;
+
+	// 계산된 변화량 적용 + 로그 (게임 스레드)
+	void ApplyTurnDelta(const FTerritoryTurnDelta& Delta);
+
+	// 생산분만 적용 (투입 자원 차감, 산출 자원 입고)
+	void ApplyProductionDelta(const FTerritoryTurnDelta& Delta);
+
+	// 소비분만 적용 (유지비 차감, 자원 상태 로그)
+	void ApplyConsumptionDelta(const FTerritoryTurnDelta& Delta);
+
+	// 건물 하나의 생산량을 변화량에 추가 (Stock = 창고 스냅샷, 투입 자원 차감됨)
+	void ComputeBuildingOutput(ABaseBuilding* Building, FResourceVector& Stock, FTerritoryTurnDelta& OutDelta) const;
+
+	// 주민 유지비 계산
+	void ComputeConsumptionDelta(FTerritoryTurnDelta& OutDelta) const;
+
+	// 길드 훈련 대기열 진행
+	void ProcessTrainingQueues();
+
+protected:
+	// 전체 건물 생산량 계산 (건물 순서대로 ComputeBuildingOutput)
+	void ComputeProductionDelta(FTerritoryTurnDelta& OutDelta) const;
+
+	// 투입 자원 차감 + ProductionPerTurn 확정 (현재 재고로 재확인, 투입 자원이 부족한 건물 산출은 제외)
+	void CommitProduction(const FTerritoryTurnDelta& Delta);
+
+	// ConsumptionPerTurn 확정
+	void CommitConsumption(const FTerritoryTurnDelta& Delta);
+
+public:
+
 	// === Trade ===
 
 	// 다른 영지로 자원 수출 (교역소 통해)
 	UFUNCTION(BlueprintCallable, Category = "Territory|Trade")
 	class ACaravan* ExportResources(
 		ATerritory* Destination,
-		TMap<EResourceType, int32> Resources,
+		const FResourceVector& Resources,
 		int32 GuardCount = 0
 	);
 
 	// 수입 자원 수령
 	UFUNCTION(BlueprintCallable, Category = "Territory|Trade")
-	void ImportResources(TMap<EResourceType, int32> Resources);
+	void ImportResources(const FResourceVector& Resources);
 
 	// === Helper Functions ===
 
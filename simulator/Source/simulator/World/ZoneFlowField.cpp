@@ -0,0 +1,121 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ZoneFlowField.h"
+
+namespace
+{
+	// Orthogonal neighbours first, then diagonals
+	const int32 NeighborOffsetsX[8] = { -1, 1, 0, 0, -1, 1, -1, 1 };
+	const int32 NeighborOffsetsY[8] = { 0, 0, -1, 1, -1, -1, 1, 1 };
+
+	// Step length in tenths of a cell
+	const uint32 StepLengths[8] = { 10, 10, 10, 10, 14, 14, 14, 14 };
+
+	// Direction code pointing back from a neighbour to the cell it was reached from
+	const uint8 OppositeDirections[8] = { 1, 0, 3, 2, 7, 6, 5, 4 };
+
+	struct FOpenCell
+	{
+		uint32 Cost;
+		int32 Index;
+	};
+
+	struct FOpenCellPredicate
+	{
+		bool operator()(const FOpenCell& A, const FOpenCell& B) const { return A.Cost < B.Cost; }
+	};
+}
+
+void FZoneFlowField::Build(const TArray<uint8>& ZoneTypeLayer, int32 InSizeX, int32 InSizeY, const TArray<int32>& GoalIndices, const TArray<uint32>& StepCosts)
+{
+	SizeX = InSizeX;
+	SizeY = InSizeY;
+
+	const int32 TotalCells = SizeX * SizeY;
+	if (TotalCells <= 0 || ZoneTypeLayer.Num() != TotalCells)
+	{
+		Reset();
+		return;
+	}
+
+	auto GetStepCost = [&](int32 Index) -> uint32
+	{
+		const uint8 ZoneType = ZoneTypeLayer[Index];
+		return StepCosts.IsValidIndex(ZoneType) ? StepCosts[ZoneType] : 0;
+	};
+
+	TArray<uint32> Integration;
+	Integration.Init(MAX_uint32, TotalCells);
+	Directions.Init(Unreachable, TotalCells);
+
+	TArray<FOpenCell> Open;
+	for (int32 GoalIndex : GoalIndices)
+	{
+		if (Integration.IsValidIndex(GoalIndex) && Integration[GoalIndex] != 0)
+		{
+			Integration[GoalIndex] = 0;
+			Directions[GoalIndex] = AtGoal;
+			Open.HeapPush({ 0, GoalIndex }, FOpenCellPredicate());
+		}
+	}
+
+	while (Open.Num() > 0)
+	{
+		FOpenCell Current;
+		Open.HeapPop(Current, FOpenCellPredicate(), EAllowShrinking::No);
+		if (Current.Cost > Integration[Current.Index])
+			continue;
+
+		const int32 X = Current.Index % SizeX;
+		const int32 Y = Current.Index / SizeX;
+
+		for (int32 Dir = 0; Dir < 8; Dir++)
+		{
+			const int32 NX = X + NeighborOffsetsX[Dir];
+			const int32 NY = Y + NeighborOffsetsY[Dir];
+			if (NX < 0 || NX >= SizeX || NY < 0 || NY >= SizeY)
+				continue;
+
+			const int32 NeighborIndex = NY * SizeX + NX;
+			const uint32 StepCost = GetStepCost(NeighborIndex);
+			if (StepCost == 0)
+				continue;
+
+			// Diagonal steps need both orthogonal cells open (goal cells count as open)
+			if (Dir >= 4)
+			{
+				const int32 SideA = Y * SizeX + NX;
+				const int32 SideB = NY * SizeX + X;
+				if ((GetStepCost(SideA) == 0 && Integration[SideA] != 0) ||
+					(GetStepCost(SideB) == 0 && Integration[SideB] != 0))
+				{
+					continue;
+				}
+			}
+
+			const uint32 NewCost = Current.Cost + StepCost * StepLengths[Dir];
+			if (NewCost < Integration[NeighborIndex])
+			{
+				Integration[NeighborIndex] = NewCost;
+				Directions[NeighborIndex] = OppositeDirections[Dir];
+				Open.HeapPush({ NewCost, NeighborIndex }, FOpenCellPredicate());
+			}
+		}
+	}
+
+	bBuilt = true;
+}
+
+void FZoneFlowField::Reset()
+{
+	Directions.Empty();
+	bBuilt = false;
+}
+
+FIntPoint FZoneFlowField::GetDirectionStep(uint8 Direction)
+{
+	if (Direction >= 8)
+		return FIntPoint(0, 0);
+
+	return FIntPoint(NeighborOffsetsX[Direction], NeighborOffsetsY[Direction]);
+}
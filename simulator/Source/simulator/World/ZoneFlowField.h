@@ -0,0 +1,48 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Flow field over the zone grid toward one goal set
+ * Stores, for every cell, the neighbour step that leads to the cheapest goal.
+ *
+ * - Built with one Dijkstra pass from all goal cells (8-connected, zone-dependent
+ *   step costs, no corner cutting past impassable cells)
+ * - Shared by every agent heading to the same goal; following it is one
+ *   array read per agent per tick
+ * - Goal cells may themselves be impassable (e.g. Water for fishing): agents
+ *   are led to their edge
+ */
+struct SIMULATOR_API FZoneFlowField
+{
+	// Direction value for goal cells
+	static constexpr uint8 AtGoal = 0xFE;
+
+	// Direction value for cells that cannot reach any goal
+	static constexpr uint8 Unreachable = 0xFF;
+
+	// Build field. StepCosts is indexed by zone type byte; 0 marks impassable zones.
+	void Build(const TArray<uint8>& ZoneTypeLayer, int32 InSizeX, int32 InSizeY, const TArray<int32>& GoalIndices, const TArray<uint32>& StepCosts);
+
+	// Drop all data (field must be rebuilt before next use)
+	void Reset();
+
+	bool IsBuilt() const { return bBuilt; }
+
+	// Direction code at a cell (0-7 neighbour index, AtGoal or Unreachable)
+	uint8 GetDirection(int32 CellIndex) const
+	{
+		return Directions.IsValidIndex(CellIndex) ? Directions[CellIndex] : Unreachable;
+	}
+
+	// Grid step for a 0-7 direction code
+	static FIntPoint GetDirectionStep(uint8 Direction);
+
+private:
+	TArray<uint8> Directions;
+	int32 SizeX = 0;
+	int32 SizeY = 0;
+	bool bBuilt = false;
+};
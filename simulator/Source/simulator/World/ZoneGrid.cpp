@@ -1,30 +1,269 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "ZoneGrid.h"
+#include "ZoneGridChunk.h"
+#include "ZoneGridOverlayComponent.h"
+#include "ZoneGridSerialization.h"
+#include "Territory.h"
+#include "TurnManagerSubsystem.h"
 #include "DrawDebugHelpers.h"
 #include "Engine/World.h"
+#include "TimerManager.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Kismet/GameplayStatics.h"
+#include "Stats/Stats.h"
+#include "Async/ParallelFor.h"
+#include "Misc/Paths.h"
+
+#if WITH_EDITOR
+#include "Misc/ScopedSlowTask.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+#endif
+
+namespace
+{
+	// Saturating subtract over a byte layer - flat loop so the compiler vectorizes it
+	void RegrowDepletionLayer(uint8* RESTRICT Depletion, int32 Count, uint8 Step)
+	{
+		for (int32 Index = 0; Index < Count; Index++)
+		{
+			const uint8 Value = Depletion[Index];
+			Depletion[Index] = Value > Step ? Value - Step : 0;
+		}
+	}
+
+	// How long a chunk read outside the streamed area keeps that chunk loaded (seconds)
+	constexpr double OnDemandChunkLifetime = 10.0;
+}
 
 AZoneGrid::AZoneGrid()
 {
 	PrimaryActorTick.bCanEverTick = false;
 
+	RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
+
+	// Create overlay component (hidden until an overlay material is assigned)
+	GridOverlay = CreateDefaultSubobject<UZoneGridOverlayComponent>(TEXT("GridOverlay"));
+	GridOverlay->SetupAttachment(RootComponent);
+
 #if WITH_EDITOR
 	bIsEditorOnlyActor = false; // We want this in runtime too
 #endif
 
 	// Set default grid origin to actor location
 	GridOrigin = GetActorLocation();
+
+	// Default walking costs (water blocks, rough terrain is slower)
+	ZoneTraversalCosts.Add(ETerrainZone::Farmland, 1.0f);
+	ZoneTraversalCosts.Add(ETerrainZone::Pasture, 1.0f);
+	ZoneTraversalCosts.Add(ETerrainZone::Forest, 2.0f);
+	ZoneTraversalCosts.Add(ETerrainZone::Mountain, 4.0f);
+	ZoneTraversalCosts.Add(ETerrainZone::Water, 0.0f);
+	ZoneTraversalCosts.Add(ETerrainZone::Settlement, 1.0f);
 }
 
 void AZoneGrid::BeginPlay()
 {
 	Super::BeginPlay();
 
+	// Fall back to the standalone data file when the level carries no cells
+	if (!HasCellData() && !bUseChunkedStorage && !ExternalDataFile.IsEmpty())
+	{
+		LoadFromZoneGridFile(GetExternalDataFilePath());
+	}
+
 	// Ensure grid is initialized at runtime
-	if (ZoneCells.Num() == 0)
+	if (!HasCellData())
 	{
 		UE_LOG(LogTemp, Warning, TEXT("ZoneGrid: No cell data found at runtime. Initialize grid in editor first!"));
 	}
+
+	// Show zone overlay at runtime if enabled
+	if (bShowGridVisualization)
+	{
+		RefreshGridOverlay();
+	}
+
+	// Chunked grids stream tiles around territories and the camera
+	if (bUseChunkedStorage && ChunkAssets.Num() > 0)
+	{
+		UpdateChunkStreaming();
+
+		GetWorld()->GetTimerManager().SetTimer(
+			ChunkStreamingTimerHandle,
+			this,
+			&AZoneGrid::UpdateChunkStreaming,
+			ChunkStreamingInterval,
+			true
+		);
+	}
+}
+
+void AZoneGrid::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (GetWorld())
+	{
+		GetWorld()->GetTimerManager().ClearTimer(ChunkStreamingTimerHandle);
+	}
+
+	for (TPair<int32, TSharedPtr<FStreamableHandle>>& Pair : ChunkHandles)
+	{
+		if (Pair.Value.IsValid())
+		{
+			Pair.Value->CancelHandle();
+		}
+	}
+	ChunkHandles.Empty();
+	ResidentChunks.Empty();
+	OnDemandChunkRequests.Empty();
+	ChunkNearestFields.Empty();
+	ChunkEdits.Empty();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void AZoneGrid::PostLoad()
+{
+	Super::PostLoad();
+
+	// Levels saved before packed storage still carry the per-cell struct array
+	MigrateLegacyCells();
+}
+
+void AZoneGrid::Serialize(FArchive& Ar)
+{
+	Super::Serialize(Ar);
+
+	Ar.UsingCustomVersion(FZoneGridCustomVersion::GUID);
+
+	// Reference collection never needs the cell bytes
+	if (Ar.IsObjectReferenceCollector())
+		return;
+
+	// Older packages carry cells in tagged properties (migrated in PostLoad)
+	if (Ar.IsLoading() && Ar.CustomVer(FZoneGridCustomVersion::GUID) < FZoneGridCustomVersion::CompactCellData)
+		return;
+
+	ZoneGridSerialization::SerializeLayers(Ar, ZoneTypeLayer, RichnessLayer);
+
+	if (Ar.IsLoading())
+	{
+		DepletionLayer.Empty();
+		PendingGatherUnits.Empty();
+		InvalidateDerivedData();
+	}
+}
+
+FString AZoneGrid::GetExternalDataFilePath() const
+{
+	if (FPaths::IsRelative(ExternalDataFile))
+	{
+		return FPaths::Combine(FPaths::ProjectContentDir(), ExternalDataFile);
+	}
+	return ExternalDataFile;
+}
+
+bool AZoneGrid::LoadFromZoneGridFile(const FString& FilePath)
+{
+	if (bUseChunkedStorage)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ZoneGrid: Cannot load %s while using chunked storage"), *FilePath);
+		return false;
+	}
+
+	int32 FileSizeX = 0;
+	int32 FileSizeY = 0;
+	TArray<uint8> LoadedZoneTypes;
+	TArray<uint8> LoadedRichness;
+
+	if (!ZoneGridSerialization::LoadFromFile(FilePath, bMemoryMapExternalData, FileSizeX, FileSizeY, LoadedZoneTypes, LoadedRichness))
+	{
+		UE_LOG(LogTemp, Error, TEXT("ZoneGrid: Failed to load zone data from %s"), *FilePath);
+		return false;
+	}
+
+	if (FileSizeX != GridSizeX || FileSizeY != GridSizeY)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ZoneGrid: %s is %dx%d, resizing grid from %dx%d"),
+			*FilePath, FileSizeX, FileSizeY, GridSizeX, GridSizeY);
+		GridSizeX = FileSizeX;
+		GridSizeY = FileSizeY;
+	}
+
+	ZoneTypeLayer = MoveTemp(LoadedZoneTypes);
+	RichnessLayer = MoveTemp(LoadedRichness);
+	DepletionLayer.Empty();
+	PendingGatherUnits.Empty();
+	InvalidateDerivedData();
+
+	if (bShowGridVisualization)
+	{
+		RefreshGridOverlay();
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("ZoneGrid: Loaded %dx%d cells from %s"), GridSizeX, GridSizeY, *FilePath);
+	return true;
+}
+
+bool AZoneGrid::SaveToZoneGridFile(const FString& FilePath) const
+{
+	if (bUseChunkedStorage || ZoneTypeLayer.Num() != GetTotalCells())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ZoneGrid: No monolithic cell data to save to %s"), *FilePath);
+		return false;
+	}
+
+	if (!ZoneGridSerialization::SaveToFile(FilePath, GridSizeX, GridSizeY, ZoneTypeLayer, RichnessLayer))
+	{
+		UE_LOG(LogTemp, Error, TEXT("ZoneGrid: Failed to write zone data to %s"), *FilePath);
+		return false;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("ZoneGrid: Saved %dx%d cells to %s"), GridSizeX, GridSizeY, *FilePath);
+	return true;
+}
+
+void AZoneGrid::AllocateLayers(ETerrainZone FillZoneType)
+{
+	const int32 TotalCells = GetTotalCells();
+
+	ZoneTypeLayer.Empty(TotalCells);
+	ZoneTypeLayer.Init(static_cast<uint8>(FillZoneType), TotalCells);
+
+	RichnessLayer.Empty(TotalCells);
+	RichnessLayer.Init(QuantizeRichness(1.0f), TotalCells);
+
+	DepletionLayer.Empty();
+	PendingGatherUnits.Empty();
+}
+
+void AZoneGrid::MigrateLegacyCells()
+{
+	if (ZoneCells_DEPRECATED.Num() == 0)
+		return;
+
+	AllocateLayers(DefaultZoneType);
+
+	int32 MigratedCount = 0;
+	for (const FZoneCellData& Cell : ZoneCells_DEPRECATED)
+	{
+		if (!IsValidGridCoords(Cell.GridCoords.X, Cell.GridCoords.Y))
+			continue;
+
+		int32 Index = GridCoordsToIndex(Cell.GridCoords.X, Cell.GridCoords.Y);
+		ZoneTypeLayer[Index] = static_cast<uint8>(Cell.ZoneType);
+		RichnessLayer[Index] = QuantizeRichness(Cell.ResourceRichness);
+		MigratedCount++;
+	}
+
+	InvalidateDerivedData();
+
+	UE_LOG(LogTemp, Log, TEXT("ZoneGrid: Migrated %d legacy cells to packed layers (%d dropped)"),
+		MigratedCount, ZoneCells_DEPRECATED.Num() - MigratedCount);
+
+	ZoneCells_DEPRECATED.Empty();
 }
 
 #if WITH_EDITOR
@@ -49,6 +288,13 @@ void AZoneGrid::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEve
 	{
 		GridOrigin = GetActorLocation();
 	}
+
+	// Movement costs feed cached flow fields and the path graph
+	if (PropertyName == GET_MEMBER_NAME_CHECKED(AZoneGrid, ZoneTraversalCosts) ||
+		PropertyName == GET_MEMBER_NAME_CHECKED(AZoneGrid, PathClusterSize))
+	{
+		InvalidateDerivedData();
+	}
 }
 
 void AZoneGrid::InitializeGrid()
@@ -59,36 +305,29 @@ void AZoneGrid::InitializeGrid()
 		return;
 	}
 
+	if (bUseChunkedStorage)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ZoneGrid: Grid uses chunked storage. Import from chunks first!"));
+		return;
+	}
+
 	int32 TotalCells = GridSizeX * GridSizeY;
 	UE_LOG(LogTemp, Log, TEXT("ZoneGrid: Initializing %dx%d grid (%d cells, Cell Size: %.0f)"),
 		GridSizeX, GridSizeY, TotalCells, CellSize);
 
-	// Clear existing data
-	ZoneCells.Empty();
-	ZoneCells.Reserve(TotalCells);
+	// Replace existing data (legacy cells are superseded too)
+	ZoneCells_DEPRECATED.Empty();
+	AllocateLayers(DefaultZoneType);
 
-	// Create all cells
-	for (int32 Y = 0; Y < GridSizeY; Y++)
+	// Auto-detect zone type if enabled
+	if (bAutoDetectZoneType)
 	{
-		for (int32 X = 0; X < GridSizeX; X++)
-		{
-			FVector WorldPos = GridCoordsToWorld(X, Y);
-			ETerrainZone ZoneType = DefaultZoneType;
-
-			// Auto-detect zone type if enabled
-			if (bAutoDetectZoneType)
-			{
-				float Height = GetTerrainHeight(WorldPos);
-				ZoneType = DetermineZoneType(WorldPos, Height);
-			}
-
-			// Create cell
-			FZoneCellData NewCell(ZoneType, FIntPoint(X, Y), WorldPos);
-			ZoneCells.Add(NewCell);
-		}
+		GenerateZoneTypes(ZoneTypeLayer);
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("ZoneGrid: Created %d cells!"), ZoneCells.Num());
+	InvalidateDerivedData();
+
+	UE_LOG(LogTemp, Log, TEXT("ZoneGrid: Created %d cells!"), ZoneTypeLayer.Num());
 
 	// Visualize
 	if (bShowGridVisualization)
@@ -99,7 +338,12 @@ void AZoneGrid::InitializeGrid()
 
 void AZoneGrid::ClearGrid()
 {
-	ZoneCells.Empty();
+	ZoneTypeLayer.Empty();
+	RichnessLayer.Empty();
+	DepletionLayer.Empty();
+	PendingGatherUnits.Empty();
+	ZoneCells_DEPRECATED.Empty();
+	InvalidateDerivedData();
 	UE_LOG(LogTemp, Log, TEXT("ZoneGrid: Cleared all cells"));
 
 	// Clear visualization
@@ -107,31 +351,41 @@ void AZoneGrid::ClearGrid()
 	{
 		FlushPersistentDebugLines(GetWorld());
 	}
+
+	if (GridOverlay)
+	{
+		GridOverlay->ClearOverlay();
+	}
 }
 
 void AZoneGrid::AutoGenerateZoneTypes()
 {
-	if (ZoneCells.Num() == 0)
+	if (!HasCellData() || bUseChunkedStorage)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("ZoneGrid: No cells to generate! Initialize grid first."));
 		return;
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("ZoneGrid: Auto-generating zone types for %d cells..."), ZoneCells.Num());
+	UE_LOG(LogTemp, Log, TEXT("ZoneGrid: Auto-generating zone types for %d cells..."), ZoneTypeLayer.Num());
+
+	TArray<uint8> NewZoneTypes;
+	GenerateZoneTypes(NewZoneTypes);
 
 	int32 UpdatedCount = 0;
-	for (FZoneCellData& Cell : ZoneCells)
+	for (int32 Index = 0; Index < ZoneTypeLayer.Num(); Index++)
 	{
-		float Height = GetTerrainHeight(Cell.WorldPosition);
-		ETerrainZone NewType = DetermineZoneType(Cell.WorldPosition, Height);
-
-		if (Cell.ZoneType != NewType)
+		if (ZoneTypeLayer[Index] != NewZoneTypes[Index])
 		{
-			Cell.ZoneType = NewType;
+			ZoneTypeLayer[Index] = NewZoneTypes[Index];
 			UpdatedCount++;
 		}
 	}
 
+	if (UpdatedCount > 0)
+	{
+		InvalidateDerivedData();
+	}
+
 	UE_LOG(LogTemp, Log, TEXT("ZoneGrid: Updated %d cells"), UpdatedCount);
 
 	// Re-visualize
@@ -150,7 +404,13 @@ void AZoneGrid::VisualizeGrid()
 	FlushPersistentDebugLines(GetWorld());
 
 	if (!bShowGridVisualization)
+	{
+		if (GridOverlay)
+		{
+			GridOverlay->ClearOverlay();
+		}
 		return;
+	}
 
 	UE_LOG(LogTemp, Log, TEXT("ZoneGrid: Visualizing grid..."));
 
@@ -174,15 +434,23 @@ void AZoneGrid::VisualizeGrid()
 		}
 	}
 
-	// Draw cell colors
-	for (const FZoneCellData& Cell : ZoneCells)
+	// Cell colors go to the texture overlay when available
+	if (GridOverlay && GridOverlay->CanDisplay())
 	{
-		FColor CellColor = GetZoneColor(Cell.ZoneType);
+		RefreshGridOverlay();
+		UE_LOG(LogTemp, Log, TEXT("ZoneGrid: Visualization complete (overlay)"));
+		return;
+	}
+
+	// Fallback: draw cell colors with debug boxes
+	auto DrawCell = [this](int32 X, int32 Y, uint8 ZoneTypeByte)
+	{
+		FColor CellColor = GetZoneColor(static_cast<ETerrainZone>(ZoneTypeByte));
 
 		// Draw filled square for cell
 		FVector CellMin = GridOrigin + FVector(
-			Cell.GridCoords.X * CellSize,
-			Cell.GridCoords.Y * CellSize,
+			X * CellSize,
+			Y * CellSize,
 			VisualizationHeight
 		);
 		FVector CellMax = CellMin + FVector(CellSize, CellSize, 0);
@@ -191,15 +459,225 @@ void AZoneGrid::VisualizeGrid()
 		FVector Center = (CellMin + CellMax) * 0.5f;
 		FVector Extent = FVector(CellSize * 0.45f, CellSize * 0.45f, 5.0f); // Slightly smaller to show borders
 		DrawDebugBox(GetWorld(), Center, Extent, CellColor, true, -1.0f, 0, 5.0f);
+	};
+
+	if (bUseChunkedStorage)
+	{
+		// Only resident chunks are drawn
+		for (const TPair<int32, UZoneGridChunk*>& Pair : ResidentChunks)
+		{
+			const UZoneGridChunk* Chunk = Pair.Value;
+			for (int32 LocalY = 0; LocalY < Chunk->ChunkSize; LocalY++)
+			{
+				for (int32 LocalX = 0; LocalX < Chunk->ChunkSize; LocalX++)
+				{
+					int32 X = Chunk->ChunkCoords.X * Chunk->ChunkSize + LocalX;
+					int32 Y = Chunk->ChunkCoords.Y * Chunk->ChunkSize + LocalY;
+					if (IsValidGridCoords(X, Y))
+					{
+						DrawCell(X, Y, Chunk->ZoneTypeLayer[Chunk->GetLocalIndex(LocalX, LocalY)]);
+					}
+				}
+			}
+		}
+	}
+	else
+	{
+		for (int32 Index = 0; Index < ZoneTypeLayer.Num(); Index++)
+		{
+			FIntPoint Coords = IndexToGridCoords(Index);
+			DrawCell(Coords.X, Coords.Y, ZoneTypeLayer[Index]);
+		}
 	}
 
 	UE_LOG(LogTemp, Log, TEXT("ZoneGrid: Visualization complete"));
 }
+
+void AZoneGrid::GenerateZoneTypes(TArray<uint8>& OutZoneTypes) const
+{
+	const int32 TotalCells = GetTotalCells();
+	OutZoneTypes.SetNumUninitialized(TotalCells);
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Rows are sampled in parallel batches; progress is reported between batches
+	const int32 RowsPerBatch = FMath::Max(1, 16384 / FMath::Max(1, GridSizeX));
+	const int32 NumBatches = FMath::DivideAndRoundUp(GridSizeY, RowsPerBatch);
+
+	FScopedSlowTask SlowTask(NumBatches, FText::Format(
+		NSLOCTEXT("ZoneGrid", "SamplingTerrain", "Sampling terrain for {0} zone cells..."), TotalCells));
+	SlowTask.MakeDialogDelayed(0.5f);
+
+	// Authored grids derive from GenerationSeed, not the per-run simulation seed
+	const FSimRandomStream GenerationStream(GenerationSeed, TEXT("ZoneGeneration"));
+
+	for (int32 Batch = 0; Batch < NumBatches; Batch++)
+	{
+		SlowTask.EnterProgressFrame(1.0f);
+
+		const int32 FirstRow = Batch * RowsPerBatch;
+		const int32 NumRows = FMath::Min(RowsPerBatch, GridSizeY - FirstRow);
+
+		ParallelFor(NumRows, [this, FirstRow, &GenerationStream, &OutZoneTypes](int32 RowOffset)
+		{
+			const int32 Y = FirstRow + RowOffset;
+
+			// One stream per row keeps results identical regardless of thread scheduling
+			FSimRandomStream RowStream = GenerationStream.Fork(Y);
+
+			for (int32 X = 0; X < GridSizeX; X++)
+			{
+				FVector WorldPos = GridCoordsToWorld(X, Y);
+				float Height = GetTerrainHeight(WorldPos);
+				OutZoneTypes[GridCoordsToIndex(X, Y)] = static_cast<uint8>(DetermineZoneType(WorldPos, Height, RowStream));
+			}
+		});
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("ZoneGrid: Sampled %d cells in %.2f ms"),
+		TotalCells, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+void AZoneGrid::ExportToChunks()
+{
+	if (bUseChunkedStorage)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ZoneGrid: Already using chunked storage"));
+		return;
+	}
+
+	if (!HasCellData() || ZoneTypeLayer.Num() != GetTotalCells())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ZoneGrid: No cells to export! Initialize grid first."));
+		return;
+	}
+
+	const int32 NumChunksX = GetNumChunksX();
+	const int32 NumChunksY = GetNumChunksY();
+	const FString Folder = ChunkAssetPath / GetName();
+
+	UE_LOG(LogTemp, Log, TEXT("ZoneGrid: Exporting %dx%d chunks (%d cells each) to %s"),
+		NumChunksX, NumChunksY, ChunkSize * ChunkSize, *Folder);
+
+	TArray<TSoftObjectPtr<UZoneGridChunk>> ExportedChunks;
+	ExportedChunks.SetNum(NumChunksX * NumChunksY);
+
+	for (int32 ChunkY = 0; ChunkY < NumChunksY; ChunkY++)
+	{
+		for (int32 ChunkX = 0; ChunkX < NumChunksX; ChunkX++)
+		{
+			const FString AssetName = FString::Printf(TEXT("ZoneChunk_%d_%d"), ChunkX, ChunkY);
+			const FString PackageName = Folder / AssetName;
+
+			UPackage* Package = CreatePackage(*PackageName);
+			UZoneGridChunk* Chunk = NewObject<UZoneGridChunk>(Package, *AssetName, RF_Public | RF_Standalone);
+			Chunk->ChunkCoords = FIntPoint(ChunkX, ChunkY);
+			Chunk->ChunkSize = ChunkSize;
+			Chunk->ZoneTypeLayer.Init(static_cast<uint8>(DefaultZoneType), ChunkSize * ChunkSize);
+			Chunk->RichnessLayer.Init(0, ChunkSize * ChunkSize);
+
+			for (int32 LocalY = 0; LocalY < ChunkSize; LocalY++)
+			{
+				for (int32 LocalX = 0; LocalX < ChunkSize; LocalX++)
+				{
+					int32 X = ChunkX * ChunkSize + LocalX;
+					int32 Y = ChunkY * ChunkSize + LocalY;
+					if (!IsValidGridCoords(X, Y))
+						continue;
+
+					int32 LocalIndex = Chunk->GetLocalIndex(LocalX, LocalY);
+					Chunk->ZoneTypeLayer[LocalIndex] = ZoneTypeLayer[GridCoordsToIndex(X, Y)];
+					Chunk->RichnessLayer[LocalIndex] = RichnessLayer[GridCoordsToIndex(X, Y)];
+				}
+			}
+
+			const FString FileName = FPackageName::LongPackageNameToFilename(PackageName, FPackageName::GetAssetPackageExtension());
+			FSavePackageArgs SaveArgs;
+			SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+			if (!UPackage::SavePackage(Package, Chunk, *FileName, SaveArgs))
+			{
+				UE_LOG(LogTemp, Error, TEXT("ZoneGrid: Failed to save chunk %s"), *PackageName);
+				return;
+			}
+
+			ExportedChunks[ChunkY * NumChunksX + ChunkX] = Chunk;
+		}
+	}
+
+	// Cell data now lives in the chunk assets, not the level
+	Modify();
+	ChunkAssets = MoveTemp(ExportedChunks);
+	ZoneTypeLayer.Empty();
+	RichnessLayer.Empty();
+	bUseChunkedStorage = true;
+	InvalidateDerivedData();
+
+	UE_LOG(LogTemp, Log, TEXT("ZoneGrid: Exported %d chunks"), ChunkAssets.Num());
+}
+
+void AZoneGrid::ImportFromChunks()
+{
+	if (!bUseChunkedStorage)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ZoneGrid: Not using chunked storage"));
+		return;
+	}
+
+	Modify();
+	AllocateLayers(DefaultZoneType);
+
+	for (const TSoftObjectPtr<UZoneGridChunk>& ChunkAsset : ChunkAssets)
+	{
+		const UZoneGridChunk* Chunk = ChunkAsset.LoadSynchronous();
+		if (!Chunk)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("ZoneGrid: Missing chunk asset %s"), *ChunkAsset.ToString());
+			continue;
+		}
+
+		for (int32 LocalY = 0; LocalY < Chunk->ChunkSize; LocalY++)
+		{
+			for (int32 LocalX = 0; LocalX < Chunk->ChunkSize; LocalX++)
+			{
+				int32 X = Chunk->ChunkCoords.X * Chunk->ChunkSize + LocalX;
+				int32 Y = Chunk->ChunkCoords.Y * Chunk->ChunkSize + LocalY;
+				if (!IsValidGridCoords(X, Y))
+					continue;
+
+				int32 LocalIndex = Chunk->GetLocalIndex(LocalX, LocalY);
+				ZoneTypeLayer[GridCoordsToIndex(X, Y)] = Chunk->ZoneTypeLayer[LocalIndex];
+				RichnessLayer[GridCoordsToIndex(X, Y)] = Chunk->RichnessLayer[LocalIndex];
+			}
+		}
+	}
+
+	ChunkHandles.Empty();
+	ResidentChunks.Empty();
+	OnDemandChunkRequests.Empty();
+	ChunkNearestFields.Empty();
+	ChunkEdits.Empty();
+	ChunkAssets.Empty();
+	bUseChunkedStorage = false;
+	InvalidateDerivedData();
+
+	UE_LOG(LogTemp, Log, TEXT("ZoneGrid: Imported chunks into %d cells"), ZoneTypeLayer.Num());
+}
+
+void AZoneGrid::ExportExternalDataFile()
+{
+	if (ExternalDataFile.IsEmpty())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ZoneGrid: Set ExternalDataFile before exporting"));
+		return;
+	}
+
+	SaveToZoneGridFile(GetExternalDataFilePath());
+}
 #endif
 
 void AZoneGrid::PaintZoneArea(FVector WorldLocation, int32 BrushRadius, ETerrainZone ZoneType)
 {
-	if (ZoneCells.Num() == 0)
+	if (!HasCellData())
 	{
 		UE_LOG(LogTemp, Warning, TEXT("ZoneGrid: No cells to paint! Initialize grid first."));
 		return;
@@ -214,6 +692,7 @@ void AZoneGrid::PaintZoneArea(FVector WorldLocation, int32 BrushRadius, ETerrain
 	}
 
 	int32 PaintedCount = 0;
+	TArray<int32> ChangedIndices;
 
 	// Paint all cells within brush radius
 	for (int32 OffsetY = -BrushRadius; OffsetY <= BrushRadius; OffsetY++)
@@ -231,74 +710,542 @@ void AZoneGrid::PaintZoneArea(FVector WorldLocation, int32 BrushRadius, ETerrain
 			if (!IsValidGridCoords(X, Y))
 				continue;
 
+			if (bUseChunkedStorage)
+			{
+				int32 LocalIndex = 0;
+				if (UZoneGridChunk* Chunk = LoadChunkForCell(X, Y, LocalIndex))
+				{
+					Chunk->ZoneTypeLayer[LocalIndex] = static_cast<uint8>(ZoneType);
+					Chunk->bModified = true;
+					Chunk->bZoneTypeModified = true;
+					ChunkNearestFields.Remove(GetChunkIndexForCell(X, Y));
+#if WITH_EDITOR
+					if (!GetWorld() || !GetWorld()->IsGameWorld())
+					{
+						Chunk->MarkPackageDirty();
+					}
+#endif
+					PaintedCount++;
+				}
+				continue;
+			}
+
 			int32 Index = GridCoordsToIndex(X, Y);
-			if (ZoneCells.IsValidIndex(Index))
+			if (ZoneTypeLayer.IsValidIndex(Index))
 			{
-				ZoneCells[Index].ZoneType = ZoneType;
+				if (ZoneTypeLayer[Index] != static_cast<uint8>(ZoneType))
+				{
+					ChangedIndices.Add(Index);
+				}
+				ZoneTypeLayer[Index] = static_cast<uint8>(ZoneType);
 				// ResourceRichness is managed by Editor Mode Toolkit
 				PaintedCount++;
 			}
 		}
 	}
 
+	if (ChangedIndices.Num() > 0)
+	{
+		OnCellsChanged(ChangedIndices);
+	}
+
 	if (PaintedCount > 0)
 	{
 		UE_LOG(LogTemp, Log, TEXT("ZoneGrid: Painted %d cells with %s"),
 			PaintedCount, *UEnum::GetValueAsString(ZoneType));
 
-		// Re-visualize
+		// Re-visualize only the painted rectangle when the overlay is up
 		if (bShowGridVisualization)
 		{
-			VisualizeGrid();
+			if (GridOverlay && GridOverlay->IsOverlayActive())
+			{
+				GridOverlay->UpdateCells(this, FIntRect(
+					CenterCoords.X - BrushRadius, CenterCoords.Y - BrushRadius,
+					CenterCoords.X + BrushRadius + 1, CenterCoords.Y + BrushRadius + 1));
+			}
+#if WITH_EDITOR
+			else
+			{
+				VisualizeGrid();
+			}
+#endif
 		}
 	}
 }
 
-// === Query Functions ===
+// === Visualization ===
 
-ETerrainZone AZoneGrid::GetZoneTypeAtLocation(FVector WorldLocation) const
+void AZoneGrid::RefreshGridOverlay()
 {
-	FZoneCellData Cell;
-	if (GetCellAtLocation(WorldLocation, Cell))
+	if (!GridOverlay)
+		return;
+
+	if (bShowGridVisualization && HasCellData())
 	{
-		return Cell.ZoneType;
+		GridOverlay->RebuildOverlay(this);
+	}
+	else
+	{
+		GridOverlay->ClearOverlay();
 	}
-	return ETerrainZone::Farmland; // Default
 }
 
-ETerrainZone AZoneGrid::GetZoneTypeAtGridCoords(int32 X, int32 Y) const
+void AZoneGrid::SetGridVisualizationVisible(bool bVisible)
 {
-	FZoneCellData Cell;
-	if (GetCellAtGridCoords(X, Y, Cell))
-	{
-		return Cell.ZoneType;
-	}
-	return ETerrainZone::Farmland; // Default
+	bShowGridVisualization = bVisible;
+	RefreshGridOverlay();
 }
 
-bool AZoneGrid::GetCellAtLocation(FVector WorldLocation, FZoneCellData& OutCell) const
+// === Query Functions ===
+
+ETerrainZone AZoneGrid::GetZoneTypeAtLocation(FVector WorldLocation) const
 {
 	FIntPoint Coords = WorldToGridCoords(WorldLocation);
-	return GetCellAtGridCoords(Coords.X, Coords.Y, OutCell);
+	return GetZoneTypeAtGridCoords(Coords.X, Coords.Y);
 }
 
-bool AZoneGrid::GetCellAtGridCoords(int32 X, int32 Y, FZoneCellData& OutCell) const
+ETerrainZone AZoneGrid::GetZoneTypeAtGridCoords(int32 X, int32 Y) const
+{
+	ETerrainZone ZoneType = ETerrainZone::Farmland; // Default
+	TryGetZoneTypeAtGridCoords(X, Y, ZoneType);
+	return ZoneType;
+}
+
+bool AZoneGrid::TryGetZoneTypeAtLocation(FVector WorldLocation, ETerrainZone& OutZoneType) const
+{
+	FIntPoint Coords = WorldToGridCoords(WorldLocation);
+	return TryGetZoneTypeAtGridCoords(Coords.X, Coords.Y, OutZoneType);
+}
+
+bool AZoneGrid::TryGetZoneTypeAtGridCoords(int32 X, int32 Y, ETerrainZone& OutZoneType) const
 {
 	if (!IsValidGridCoords(X, Y))
 		return false;
 
+	if (bUseChunkedStorage)
+	{
+		// Not streamed in yet - unknown (the chunk is queued for loading)
+		int32 LocalIndex = 0;
+		const UZoneGridChunk* Chunk = GetChunkForCell(X, Y, LocalIndex);
+		if (!Chunk)
+			return false;
+
+		OutZoneType = static_cast<ETerrainZone>(Chunk->ZoneTypeLayer[LocalIndex]);
+		return true;
+	}
+
 	int32 Index = GridCoordsToIndex(X, Y);
-	if (!ZoneCells.IsValidIndex(Index))
+	if (!ZoneTypeLayer.IsValidIndex(Index))
+		return false;
+
+	OutZoneType = static_cast<ETerrainZone>(ZoneTypeLayer[Index]);
+	return true;
+}
+
+float AZoneGrid::GetResourceRichnessAtGridCoords(int32 X, int32 Y) const
+{
+	if (bUseChunkedStorage)
+	{
+		int32 LocalIndex = 0;
+		if (IsValidGridCoords(X, Y))
+		{
+			if (const UZoneGridChunk* Chunk = GetChunkForCell(X, Y, LocalIndex))
+			{
+				uint8 Depletion = Chunk->DepletionLayer.IsValidIndex(LocalIndex) ? Chunk->DepletionLayer[LocalIndex] : 0;
+				return DequantizeRichness(ApplyDepletion(Chunk->RichnessLayer[LocalIndex], Depletion));
+			}
+		}
+		return 0.0f;
+	}
+
+	if (IsValidGridCoords(X, Y))
+	{
+		int32 Index = GridCoordsToIndex(X, Y);
+		if (RichnessLayer.IsValidIndex(Index))
+		{
+			uint8 Depletion = DepletionLayer.IsValidIndex(Index) ? DepletionLayer[Index] : 0;
+			return DequantizeRichness(ApplyDepletion(RichnessLayer[Index], Depletion));
+		}
+	}
+	return 0.0f;
+}
+
+bool AZoneGrid::GetCellAtLocation(FVector WorldLocation, FZoneCellData& OutCell) const
+{
+	FIntPoint Coords = WorldToGridCoords(WorldLocation);
+	return GetCellAtGridCoords(Coords.X, Coords.Y, OutCell);
+}
+
+bool AZoneGrid::GetCellAtGridCoords(int32 X, int32 Y, FZoneCellData& OutCell) const
+{
+	if (!IsValidGridCoords(X, Y))
+		return false;
+
+	uint8 ZoneTypeByte = 0;
+	uint8 RichnessByte = 0;
+
+	if (bUseChunkedStorage)
+	{
+		int32 LocalIndex = 0;
+		const UZoneGridChunk* Chunk = GetChunkForCell(X, Y, LocalIndex);
+		if (!Chunk)
+			return false;
+
+		ZoneTypeByte = Chunk->ZoneTypeLayer[LocalIndex];
+		RichnessByte = ApplyDepletion(Chunk->RichnessLayer[LocalIndex],
+			Chunk->DepletionLayer.IsValidIndex(LocalIndex) ? Chunk->DepletionLayer[LocalIndex] : 0);
+	}
+	else
+	{
+		int32 Index = GridCoordsToIndex(X, Y);
+		if (!ZoneTypeLayer.IsValidIndex(Index) || !RichnessLayer.IsValidIndex(Index))
+			return false;
+
+		ZoneTypeByte = ZoneTypeLayer[Index];
+		RichnessByte = ApplyDepletion(RichnessLayer[Index], DepletionLayer.IsValidIndex(Index) ? DepletionLayer[Index] : 0);
+	}
+
+	// Unpack cell; coordinates and position are derived, not stored
+	OutCell.ZoneType = static_cast<ETerrainZone>(ZoneTypeByte);
+	OutCell.GridCoords = FIntPoint(X, Y);
+	OutCell.WorldPosition = GridCoordsToWorld(X, Y);
+	OutCell.ResourceRichness = DequantizeRichness(RichnessByte);
+	return true;
+}
+
+bool AZoneGrid::FindNearestZoneCell(FVector FromLocation, ETerrainZone ZoneType, FVector& OutLocation) const
+{
+	if (bUseChunkedStorage)
+	{
+		// No whole-grid field in chunked mode - search the streamed-in area
+		FIntPoint NearestCoords;
+		if (!FindNearestZoneCellInResidentChunks(WorldToGridCoords(FromLocation), static_cast<uint8>(ZoneType), NearestCoords))
+			return false;
+
+		OutLocation = GridCoordsToWorld(NearestCoords.X, NearestCoords.Y);
+		return true;
+	}
+
+	if (!HasCellData() || ZoneTypeLayer.Num() != GetTotalCells())
+		return false;
+
+	const int32 ZoneIndex = static_cast<int32>(ZoneType);
+	if (!NearestZoneFields.IsValidIndex(ZoneIndex))
+	{
+		NearestZoneFields.SetNum(ZoneIndex + 1);
+	}
+
+	FZoneNearestField& Field = NearestZoneFields[ZoneIndex];
+	if (!Field.IsBuilt())
+	{
+		Field.Build(ZoneTypeLayer, GridSizeX, GridSizeY, static_cast<uint8>(ZoneType));
+	}
+
+	// Locations outside the grid resolve from the closest edge cell
+	FIntPoint Coords = WorldToGridCoords(FromLocation);
+	Coords.X = FMath::Clamp(Coords.X, 0, GridSizeX - 1);
+	Coords.Y = FMath::Clamp(Coords.Y, 0, GridSizeY - 1);
+
+	const int32 NearestIndex = Field.GetNearestIndex(GridCoordsToIndex(Coords.X, Coords.Y));
+
+	// Local patches clear every cell of a removed source, so entries always name a live source
+	if (NearestIndex == INDEX_NONE || !ensure(ZoneTypeLayer[NearestIndex] == static_cast<uint8>(ZoneType)))
+		return false;
+
+	FIntPoint NearestCoords = IndexToGridCoords(NearestIndex);
+	OutLocation = GridCoordsToWorld(NearestCoords.X, NearestCoords.Y);
+	return true;
+}
+
+// === Regions ===
+
+bool AZoneGrid::EnsureRegionLabels() const
+{
+	if (bUseChunkedStorage || ZoneTypeLayer.Num() != GetTotalCells() || RichnessLayer.Num() != GetTotalCells())
+		return false;
+
+	if (!ZoneRegions.IsBuilt())
+	{
+		ZoneRegions.Build(ZoneTypeLayer, RichnessLayer, GridSizeX, GridSizeY);
+	}
+	return ZoneRegions.IsBuilt();
+}
+
+bool AZoneGrid::GetRegionAtLocation(FVector WorldLocation, FZoneRegionInfo& OutRegion) const
+{
+	FIntPoint Coords = WorldToGridCoords(WorldLocation);
+	return GetRegionInfo(GetRegionIdAtGridCoords(Coords.X, Coords.Y), OutRegion);
+}
+
+int32 AZoneGrid::GetRegionIdAtGridCoords(int32 X, int32 Y) const
+{
+	if (!IsValidGridCoords(X, Y) || !EnsureRegionLabels())
+		return INDEX_NONE;
+
+	return ZoneRegions.GetRegionId(GridCoordsToIndex(X, Y));
+}
+
+bool AZoneGrid::GetRegionInfo(int32 RegionId, FZoneRegionInfo& OutRegion) const
+{
+	if (!EnsureRegionLabels())
+		return false;
+
+	const FZoneRegionLabels::FRegion* Region = ZoneRegions.GetRegion(RegionId);
+	if (!Region)
 		return false;
 
-	OutCell = ZoneCells[Index];
+	OutRegion.RegionId = RegionId;
+	OutRegion.ZoneType = static_cast<ETerrainZone>(Region->ZoneType);
+	OutRegion.CellCount = Region->Area;
+	OutRegion.BoundsMin = Region->Min;
+	OutRegion.BoundsMax = Region->Max;
+	OutRegion.RichnessSum = Region->RichnessSum * (1.0f / 255.0f);
+
+	// Mean cell center in grid space, then to world
+	const double MeanX = static_cast<double>(Region->SumX) / Region->Area + 0.5;
+	const double MeanY = static_cast<double>(Region->SumY) / Region->Area + 0.5;
+	OutRegion.Centroid = GridOrigin + FVector(MeanX * CellSize, MeanY * CellSize, 0.0);
 	return true;
 }
 
+int32 AZoneGrid::GetRegionCount() const
+{
+	return EnsureRegionLabels() ? ZoneRegions.GetNumRegions() : 0;
+}
+
+// === Resource Depletion ===
+
+float AZoneGrid::GetAvailableRichnessAtLocation(FVector WorldLocation) const
+{
+	FIntPoint Coords = WorldToGridCoords(WorldLocation);
+	if (!IsValidGridCoords(Coords.X, Coords.Y))
+		return 0.0f;
+
+	float Richness = GetResourceRichnessAtGridCoords(Coords.X, Coords.Y);
+
+	// Gathers already queued this turn count against the cell
+	if (const int32* PendingUnits = PendingGatherUnits.Find(GridCoordsToIndex(Coords.X, Coords.Y)))
+	{
+		Richness -= *PendingUnits * DepletionPerUnit;
+	}
+
+	return FMath::Max(Richness, 0.0f);
+}
+
+void AZoneGrid::QueueGatherEvent(FVector WorldLocation, int32 Amount)
+{
+	FIntPoint Coords = WorldToGridCoords(WorldLocation);
+	if (Amount <= 0 || !IsValidGridCoords(Coords.X, Coords.Y))
+		return;
+
+	PendingGatherUnits.FindOrAdd(GridCoordsToIndex(Coords.X, Coords.Y)) += Amount;
+}
+
+void AZoneGrid::ProcessResourceTurn()
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_ZoneGrid_ProcessResourceTurn);
+
+	if (!HasCellData())
+	{
+		PendingGatherUnits.Reset();
+		return;
+	}
+
+	// 1. Apply this turn's gathers as one batch
+	for (const TPair<int32, int32>& Gather : PendingGatherUnits)
+	{
+		const int32 DepletionAmount = FMath::RoundToInt(Gather.Value * DepletionPerUnit * 255.0f);
+		uint8* Depletion = nullptr;
+
+		if (bUseChunkedStorage)
+		{
+			FIntPoint Coords = IndexToGridCoords(Gather.Key);
+			int32 LocalIndex = 0;
+			if (UZoneGridChunk* Chunk = LoadChunkForCell(Coords.X, Coords.Y, LocalIndex))
+			{
+				if (Chunk->DepletionLayer.Num() == 0)
+				{
+					Chunk->DepletionLayer.Init(0, Chunk->ZoneTypeLayer.Num());
+				}
+				// Stashed on unload so the depletion survives streaming
+				Chunk->bModified = true;
+				Depletion = &Chunk->DepletionLayer[LocalIndex];
+			}
+		}
+		else if (RichnessLayer.IsValidIndex(Gather.Key))
+		{
+			if (DepletionLayer.Num() != RichnessLayer.Num())
+			{
+				DepletionLayer.Init(0, RichnessLayer.Num());
+			}
+			Depletion = &DepletionLayer[Gather.Key];
+		}
+
+		if (Depletion)
+		{
+			*Depletion = static_cast<uint8>(FMath::Min(255, *Depletion + DepletionAmount));
+		}
+	}
+
+	const int32 GatheredCells = PendingGatherUnits.Num();
+	PendingGatherUnits.Reset();
+
+	// 2. Regrow every depleted cell in a single pass over the depletion layer
+	const uint8 RegrowthStep = QuantizeRichness(RegrowthPerTurn);
+	if (RegrowthStep > 0)
+	{
+		if (bUseChunkedStorage)
+		{
+			for (const TPair<int32, UZoneGridChunk*>& Pair : ResidentChunks)
+			{
+				TArray<uint8>& ChunkDepletion = Pair.Value->DepletionLayer;
+				if (ChunkDepletion.Num() > 0)
+				{
+					RegrowDepletionLayer(ChunkDepletion.GetData(), ChunkDepletion.Num(), RegrowthStep);
+				}
+			}
+
+			// Unloaded chunks keep regrowing; drop stashes that have fully recovered
+			for (auto It = ChunkEdits.CreateIterator(); It; ++It)
+			{
+				TArray<uint8>& StashedDepletion = It.Value().DepletionLayer;
+				if (StashedDepletion.Num() == 0)
+					continue;
+
+				RegrowDepletionLayer(StashedDepletion.GetData(), StashedDepletion.Num(), RegrowthStep);
+				if (It.Value().ZoneTypeLayer.Num() == 0 && !StashedDepletion.ContainsByPredicate([](uint8 Value) { return Value != 0; }))
+				{
+					It.RemoveCurrent();
+				}
+			}
+		}
+		else if (DepletionLayer.Num() > 0)
+		{
+			RegrowDepletionLayer(DepletionLayer.GetData(), DepletionLayer.Num(), RegrowthStep);
+		}
+	}
+
+	UE_LOG(LogTerritoryTurn, Verbose, TEXT("ZoneGrid: Resource turn - depleted %d cells, regrowth %.3f"),
+		GatheredCells, DequantizeRichness(RegrowthStep));
+}
+
 bool AZoneGrid::CanBuildAtLocation(FVector WorldLocation, ETerrainZone RequiredZoneType) const
 {
-	ETerrainZone ZoneType = GetZoneTypeAtLocation(WorldLocation);
-	return ZoneType == RequiredZoneType;
+	// Unknown cells (not streamed in yet) are not buildable
+	FZoneCellData Cell;
+	return GetCellAtLocation(WorldLocation, Cell) && Cell.ZoneType == RequiredZoneType;
+}
+
+// === Footprint Queries ===
+
+int32 AZoneGrid::CountZoneCellsInRect(FIntPoint MinCoords, FIntPoint MaxCoords, ETerrainZone ZoneType) const
+{
+	const int32 MinX = FMath::Max(MinCoords.X, 0);
+	const int32 MinY = FMath::Max(MinCoords.Y, 0);
+	const int32 MaxX = FMath::Min(MaxCoords.X, GridSizeX - 1);
+	const int32 MaxY = FMath::Min(MaxCoords.Y, GridSizeY - 1);
+	if (MinX > MaxX || MinY > MaxY || !HasCellData())
+		return 0;
+
+	if (bUseChunkedStorage)
+	{
+		// No whole-grid table in chunked mode - count cell by cell (cells not streamed in don't count)
+		int32 Count = 0;
+		for (int32 Y = MinY; Y <= MaxY; Y++)
+		{
+			for (int32 X = MinX; X <= MaxX; X++)
+			{
+				int32 LocalIndex = 0;
+				if (const UZoneGridChunk* Chunk = GetChunkForCell(X, Y, LocalIndex))
+				{
+					Count += Chunk->ZoneTypeLayer[LocalIndex] == static_cast<uint8>(ZoneType) ? 1 : 0;
+				}
+			}
+		}
+		return Count;
+	}
+
+	if (ZoneTypeLayer.Num() != GetTotalCells())
+		return 0;
+
+	const int32 ZoneIndex = static_cast<int32>(ZoneType);
+	if (!ZoneCountTables.IsValidIndex(ZoneIndex))
+	{
+		ZoneCountTables.SetNum(ZoneIndex + 1);
+	}
+
+	FZoneSummedAreaTable& Table = ZoneCountTables[ZoneIndex];
+	if (!Table.IsBuilt())
+	{
+		Table.BuildCount(ZoneTypeLayer, GridSizeX, GridSizeY, static_cast<uint8>(ZoneType));
+	}
+
+	return static_cast<int32>(Table.GetRectSum(MinX, MinY, MaxX, MaxY));
+}
+
+float AZoneGrid::GetMeanRichnessInRect(FIntPoint MinCoords, FIntPoint MaxCoords) const
+{
+	const int32 MinX = FMath::Max(MinCoords.X, 0);
+	const int32 MinY = FMath::Max(MinCoords.Y, 0);
+	const int32 MaxX = FMath::Min(MaxCoords.X, GridSizeX - 1);
+	const int32 MaxY = FMath::Min(MaxCoords.Y, GridSizeY - 1);
+	if (MinX > MaxX || MinY > MaxY || !HasCellData())
+		return 0.0f;
+
+	const int32 NumCells = (MaxX - MinX + 1) * (MaxY - MinY + 1);
+
+	if (bUseChunkedStorage)
+	{
+		float Sum = 0.0f;
+		for (int32 Y = MinY; Y <= MaxY; Y++)
+		{
+			for (int32 X = MinX; X <= MaxX; X++)
+			{
+				Sum += GetResourceRichnessAtGridCoords(X, Y);
+			}
+		}
+		return Sum / NumCells;
+	}
+
+	if (RichnessLayer.Num() != GetTotalCells())
+		return 0.0f;
+
+	if (!RichnessSumTable.IsBuilt())
+	{
+		RichnessSumTable.BuildSum(RichnessLayer, GridSizeX, GridSizeY);
+	}
+
+	return RichnessSumTable.GetRectSum(MinX, MinY, MaxX, MaxY) / (255.0f * NumCells);
+}
+
+void AZoneGrid::GetFootprintCellBounds(FVector Center, FRotator Rotation, FVector2D FootprintSize, FIntPoint& OutMinCoords, FIntPoint& OutMaxCoords) const
+{
+	// Half extents of the rotated rectangle's axis-aligned bounds
+	const float Yaw = FMath::DegreesToRadians(Rotation.Yaw);
+	const float AbsCos = FMath::Abs(FMath::Cos(Yaw));
+	const float AbsSin = FMath::Abs(FMath::Sin(Yaw));
+	const float HalfX = 0.5f * (AbsCos * FootprintSize.X + AbsSin * FootprintSize.Y);
+	const float HalfY = 0.5f * (AbsSin * FootprintSize.X + AbsCos * FootprintSize.Y);
+
+	// Shrink the far edge slightly so a footprint ending exactly on a cell border stays out of the next cell
+	OutMinCoords = WorldToGridCoords(Center - FVector(HalfX, HalfY, 0.0f));
+	OutMaxCoords = WorldToGridCoords(Center + FVector(HalfX - 1.0f, HalfY - 1.0f, 0.0f));
+	OutMaxCoords.X = FMath::Max(OutMaxCoords.X, OutMinCoords.X);
+	OutMaxCoords.Y = FMath::Max(OutMaxCoords.Y, OutMinCoords.Y);
+}
+
+bool AZoneGrid::CanBuildFootprint(FVector Center, FRotator Rotation, FVector2D FootprintSize, ETerrainZone RequiredZoneType, float MinCoverage) const
+{
+	FIntPoint MinCoords;
+	FIntPoint MaxCoords;
+	GetFootprintCellBounds(Center, Rotation, FootprintSize, MinCoords, MaxCoords);
+
+	if (!IsValidGridCoords(MinCoords.X, MinCoords.Y) || !IsValidGridCoords(MaxCoords.X, MaxCoords.Y))
+		return false;
+
+	const int32 NumCells = (MaxCoords.X - MinCoords.X + 1) * (MaxCoords.Y - MinCoords.Y + 1);
+	const int32 MatchingCells = CountZoneCellsInRect(MinCoords, MaxCoords, RequiredZoneType);
+	return MatchingCells >= FMath::CeilToInt(NumCells * FMath::Clamp(MinCoverage, 0.0f, 1.0f));
 }
 
 FIntPoint AZoneGrid::WorldToGridCoords(FVector WorldLocation) const
@@ -318,11 +1265,480 @@ FVector AZoneGrid::GridCoordsToWorld(int32 X, int32 Y) const
 	return FVector(WorldX, WorldY, WorldZ);
 }
 
+// === Chunk Streaming ===
+
+void AZoneGrid::AddStreamingSource(FVector WorldLocation, float Radius)
+{
+	ExtraStreamingSources.Add(FSphere(WorldLocation, Radius));
+}
+
+void AZoneGrid::UpdateChunkStreaming()
+{
+	if (!bUseChunkedStorage || ChunkAssets.Num() == 0 || !GetWorld())
+		return;
+
+	// Gather focus points: registered extras, active territories, player camera
+	TArray<FSphere> Sources = MoveTemp(ExtraStreamingSources);
+	ExtraStreamingSources.Reset();
+
+	if (UTurnManagerSubsystem* TurnManager = GetWorld()->GetSubsystem<UTurnManagerSubsystem>())
+	{
+		for (ATerritory* Territory : TurnManager->GetRegisteredTerritories())
+		{
+			if (Territory)
+			{
+				Sources.Add(FSphere(Territory->TerritoryCenter, Territory->TerritoryRadius + ChunkStreamingRadius));
+			}
+		}
+	}
+
+	if (APlayerCameraManager* CameraManager = UGameplayStatics::GetPlayerCameraManager(this, 0))
+	{
+		Sources.Add(FSphere(CameraManager->GetCameraLocation(), ChunkStreamingRadius));
+	}
+
+	// Chunks overlapping each source's bounding square
+	const int32 NumChunksX = GetNumChunksX();
+	const int32 NumChunksY = GetNumChunksY();
+	TSet<int32> DesiredChunks;
+
+	for (const FSphere& Source : Sources)
+	{
+		FIntPoint MinCoords = WorldToGridCoords(Source.Center - FVector(Source.W, Source.W, 0.0f));
+		FIntPoint MaxCoords = WorldToGridCoords(Source.Center + FVector(Source.W, Source.W, 0.0f));
+
+		int32 MinChunkX = FMath::Clamp(MinCoords.X, 0, GridSizeX - 1) / ChunkSize;
+		int32 MinChunkY = FMath::Clamp(MinCoords.Y, 0, GridSizeY - 1) / ChunkSize;
+		int32 MaxChunkX = FMath::Clamp(MaxCoords.X, 0, GridSizeX - 1) / ChunkSize;
+		int32 MaxChunkY = FMath::Clamp(MaxCoords.Y, 0, GridSizeY - 1) / ChunkSize;
+
+		for (int32 ChunkY = MinChunkY; ChunkY <= MaxChunkY && ChunkY < NumChunksY; ChunkY++)
+		{
+			for (int32 ChunkX = MinChunkX; ChunkX <= MaxChunkX && ChunkX < NumChunksX; ChunkX++)
+			{
+				DesiredChunks.Add(ChunkY * NumChunksX + ChunkX);
+			}
+		}
+	}
+
+	// Chunks read outside the streamed area recently (see GetChunkForCell)
+	const double Now = FPlatformTime::Seconds();
+	for (auto It = OnDemandChunkRequests.CreateIterator(); It; ++It)
+	{
+		if (Now - It.Value() > OnDemandChunkLifetime)
+		{
+			It.RemoveCurrent();
+		}
+		else
+		{
+			DesiredChunks.Add(It.Key());
+		}
+	}
+
+	// Unload chunks outside every source (runtime edits are stashed and restored on the next load)
+	int32 UnloadedCount = 0;
+	for (auto It = ChunkHandles.CreateIterator(); It; ++It)
+	{
+		const int32 ChunkIndex = It.Key();
+		if (DesiredChunks.Contains(ChunkIndex))
+			continue;
+
+		UZoneGridChunk* Resident = ResidentChunks.FindRef(ChunkIndex);
+		if (Resident && Resident->bModified)
+		{
+			StashChunkEdits(ChunkIndex, Resident);
+		}
+
+		if (It.Value().IsValid())
+		{
+			if (Resident)
+			{
+				It.Value()->ReleaseHandle();
+			}
+			else
+			{
+				It.Value()->CancelHandle();
+			}
+		}
+
+		ResidentChunks.Remove(ChunkIndex);
+		ChunkNearestFields.Remove(ChunkIndex);
+		It.RemoveCurrent();
+		UnloadedCount++;
+
+		if (GridOverlay && GridOverlay->IsOverlayActive())
+		{
+			GridOverlay->UpdateCells(this, GetChunkCellRect(ChunkIndex));
+		}
+	}
+
+	// Request newly needed chunks
+	int32 RequestedCount = 0;
+	for (int32 ChunkIndex : DesiredChunks)
+	{
+		if (ChunkHandles.Contains(ChunkIndex) || !ChunkAssets.IsValidIndex(ChunkIndex) || ChunkAssets[ChunkIndex].IsNull())
+			continue;
+
+		// Reserve the slot first - the callback may fire synchronously if already loaded
+		TSharedPtr<FStreamableHandle>& Handle = ChunkHandles.Add(ChunkIndex);
+		Handle = ChunkStreamableManager.RequestAsyncLoad(
+			ChunkAssets[ChunkIndex].ToSoftObjectPath(),
+			FStreamableDelegate::CreateUObject(this, &AZoneGrid::OnChunkLoaded, ChunkIndex)
+		);
+		RequestedCount++;
+	}
+
+	if (UnloadedCount > 0 || RequestedCount > 0)
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("ZoneGrid: Streaming - requested %d, unloaded %d, resident %d"),
+			RequestedCount, UnloadedCount, ResidentChunks.Num());
+	}
+}
+
+void AZoneGrid::OnChunkLoaded(int32 ChunkIndex)
+{
+	// Ignore completions for chunks unloaded while in flight
+	if (!ChunkHandles.Contains(ChunkIndex) || !ChunkAssets.IsValidIndex(ChunkIndex))
+		return;
+
+	if (UZoneGridChunk* Chunk = ChunkAssets[ChunkIndex].Get())
+	{
+		RestoreChunkEdits(ChunkIndex, Chunk);
+		ResidentChunks.Add(ChunkIndex, Chunk);
+
+		if (GridOverlay && GridOverlay->IsOverlayActive())
+		{
+			GridOverlay->UpdateCells(this, GetChunkCellRect(ChunkIndex));
+		}
+	}
+}
+
+void AZoneGrid::StashChunkEdits(int32 ChunkIndex, UZoneGridChunk* Chunk)
+{
+	FZoneGridChunkEdits& Edits = ChunkEdits.FindOrAdd(ChunkIndex);
+	if (Chunk->bZoneTypeModified)
+	{
+		Edits.ZoneTypeLayer = Chunk->ZoneTypeLayer;
+	}
+	Edits.DepletionLayer = MoveTemp(Chunk->DepletionLayer);
+
+	Chunk->DepletionLayer.Reset();
+	Chunk->bModified = false;
+	Chunk->bZoneTypeModified = false;
+}
+
+void AZoneGrid::RestoreChunkEdits(int32 ChunkIndex, UZoneGridChunk* Chunk)
+{
+	FZoneGridChunkEdits Edits;
+	if (!ChunkEdits.RemoveAndCopyValue(ChunkIndex, Edits))
+		return;
+
+	if (Edits.ZoneTypeLayer.Num() == Chunk->ZoneTypeLayer.Num())
+	{
+		Chunk->ZoneTypeLayer = MoveTemp(Edits.ZoneTypeLayer);
+		Chunk->bZoneTypeModified = true;
+	}
+	if (Edits.DepletionLayer.Num() == Chunk->ZoneTypeLayer.Num())
+	{
+		Chunk->DepletionLayer = MoveTemp(Edits.DepletionLayer);
+	}
+	Chunk->bModified = true;
+	ChunkNearestFields.Remove(ChunkIndex);
+}
+
+FIntRect AZoneGrid::GetChunkCellRect(int32 ChunkIndex) const
+{
+	const int32 NumChunksX = GetNumChunksX();
+	const FIntPoint Min((ChunkIndex % NumChunksX) * ChunkSize, (ChunkIndex / NumChunksX) * ChunkSize);
+	return FIntRect(Min, Min + FIntPoint(ChunkSize, ChunkSize));
+}
+
+UZoneGridChunk* AZoneGrid::GetChunkForCell(int32 X, int32 Y, int32& OutLocalIndex) const
+{
+	const int32 ChunkIndex = GetChunkIndexForCell(X, Y);
+	UZoneGridChunk* Chunk = ResidentChunks.FindRef(ChunkIndex);
+
+	if (!Chunk && ChunkAssets.IsValidIndex(ChunkIndex) && !ChunkAssets[ChunkIndex].IsNull())
+	{
+		const UWorld* World = GetWorld();
+		if (World && World->IsGameWorld())
+		{
+			// Outside the streamed area - use the asset only if it is already in memory, and let
+			// the next streaming update make it resident instead of blocking the game thread
+			// (not if it has stashed edits - its in-memory layers are out of date until restored)
+			Chunk = ChunkEdits.Contains(ChunkIndex) ? nullptr : ChunkAssets[ChunkIndex].Get();
+			RequestChunkLoad(ChunkIndex);
+		}
+		else
+		{
+			// Editor tools have no streamed area
+			Chunk = ChunkAssets[ChunkIndex].LoadSynchronous();
+		}
+	}
+
+	if (!Chunk)
+		return nullptr;
+
+	OutLocalIndex = Chunk->GetLocalIndex(X % ChunkSize, Y % ChunkSize);
+	if (!Chunk->ZoneTypeLayer.IsValidIndex(OutLocalIndex) || !Chunk->RichnessLayer.IsValidIndex(OutLocalIndex))
+		return nullptr;
+
+	return Chunk;
+}
+
+UZoneGridChunk* AZoneGrid::LoadChunkForCell(int32 X, int32 Y, int32& OutLocalIndex)
+{
+	const int32 ChunkIndex = GetChunkIndexForCell(X, Y);
+	UZoneGridChunk* Chunk = ResidentChunks.FindRef(ChunkIndex);
+
+	if (!Chunk && ChunkAssets.IsValidIndex(ChunkIndex) && !ChunkAssets[ChunkIndex].IsNull())
+	{
+		// Edits must not be dropped - finish or start the load now and keep the chunk resident
+		if (const TSharedPtr<FStreamableHandle>* InFlight = ChunkHandles.Find(ChunkIndex))
+		{
+			if (InFlight->IsValid())
+			{
+				(*InFlight)->WaitUntilComplete();
+			}
+			Chunk = ResidentChunks.FindRef(ChunkIndex);
+		}
+
+		if (!Chunk)
+		{
+			TSharedPtr<FStreamableHandle> Handle = ChunkStreamableManager.RequestSyncLoad(ChunkAssets[ChunkIndex].ToSoftObjectPath());
+			Chunk = Handle.IsValid() ? Cast<UZoneGridChunk>(Handle->GetLoadedAsset()) : nullptr;
+			if (Chunk)
+			{
+				RestoreChunkEdits(ChunkIndex, Chunk);
+				ChunkHandles.Add(ChunkIndex, Handle);
+				ResidentChunks.Add(ChunkIndex, Chunk);
+			}
+		}
+	}
+
+	if (!Chunk)
+		return nullptr;
+
+	OutLocalIndex = Chunk->GetLocalIndex(X % ChunkSize, Y % ChunkSize);
+	if (!Chunk->ZoneTypeLayer.IsValidIndex(OutLocalIndex) || !Chunk->RichnessLayer.IsValidIndex(OutLocalIndex))
+		return nullptr;
+
+	return Chunk;
+}
+
+void AZoneGrid::RequestChunkLoad(int32 ChunkIndex) const
+{
+	if (ChunkAssets.IsValidIndex(ChunkIndex) && !ChunkAssets[ChunkIndex].IsNull())
+	{
+		OnDemandChunkRequests.Add(ChunkIndex, FPlatformTime::Seconds());
+	}
+}
+
+const FZoneNearestField& AZoneGrid::GetChunkNearestField(int32 ChunkIndex, uint8 ZoneType) const
+{
+	TArray<FZoneNearestField>& Fields = ChunkNearestFields.FindOrAdd(ChunkIndex);
+	if (!Fields.IsValidIndex(ZoneType))
+	{
+		Fields.SetNum(ZoneType + 1);
+	}
+
+	FZoneNearestField& Field = Fields[ZoneType];
+	if (!Field.IsBuilt())
+	{
+		// Edge chunks are padded past the grid - padding cells never match
+		TArray<uint8> Layer = ResidentChunks.FindChecked(ChunkIndex)->ZoneTypeLayer;
+		const FIntRect Rect = GetChunkCellRect(ChunkIndex);
+		for (int32 LocalY = 0; LocalY < ChunkSize; LocalY++)
+		{
+			for (int32 LocalX = 0; LocalX < ChunkSize; LocalX++)
+			{
+				if (!IsValidGridCoords(Rect.Min.X + LocalX, Rect.Min.Y + LocalY))
+				{
+					Layer[LocalY * ChunkSize + LocalX] = MAX_uint8;
+				}
+			}
+		}
+
+		Field.Build(Layer, ChunkSize, ChunkSize, ZoneType);
+	}
+
+	return Field;
+}
+
+bool AZoneGrid::FindNearestZoneCellInResidentChunks(FIntPoint FromCoords, uint8 ZoneType, FIntPoint& OutCoords) const
+{
+	// Resident chunks ordered by distance from the query to their cell rectangle (a lower bound)
+	TArray<TPair<int64, int32>, TInlineAllocator<64>> Candidates;
+	for (const TPair<int32, UZoneGridChunk*>& Pair : ResidentChunks)
+	{
+		if (Pair.Value->ZoneTypeLayer.Num() != ChunkSize * ChunkSize)
+			continue;
+
+		const FIntRect Rect = GetChunkCellRect(Pair.Key);
+		const int64 DX = FMath::Max3(Rect.Min.X - FromCoords.X, 0, FromCoords.X - (Rect.Max.X - 1));
+		const int64 DY = FMath::Max3(Rect.Min.Y - FromCoords.Y, 0, FromCoords.Y - (Rect.Max.Y - 1));
+		Candidates.Emplace(DX * DX + DY * DY, Pair.Key);
+	}
+	Candidates.Sort([](const TPair<int64, int32>& A, const TPair<int64, int32>& B) { return A.Key < B.Key; });
+
+	int64 BestDistSquared = MAX_int64;
+	for (const TPair<int64, int32>& Candidate : Candidates)
+	{
+		// No later chunk can hold anything closer
+		if (Candidate.Key >= BestDistSquared)
+			break;
+
+		// Field lookup from the chunk cell closest to the query (exact for the query's own chunk)
+		const FIntRect Rect = GetChunkCellRect(Candidate.Value);
+		const int32 LocalX = FMath::Clamp(FromCoords.X - Rect.Min.X, 0, ChunkSize - 1);
+		const int32 LocalY = FMath::Clamp(FromCoords.Y - Rect.Min.Y, 0, ChunkSize - 1);
+		const int32 NearestLocalIndex = GetChunkNearestField(Candidate.Value, ZoneType).GetNearestIndex(LocalY * ChunkSize + LocalX);
+		if (NearestLocalIndex == INDEX_NONE)
+			continue;
+
+		const int32 X = Rect.Min.X + NearestLocalIndex % ChunkSize;
+		const int32 Y = Rect.Min.Y + NearestLocalIndex / ChunkSize;
+		const int64 DX = X - FromCoords.X;
+		const int64 DY = Y - FromCoords.Y;
+		const int64 DistSquared = DX * DX + DY * DY;
+		if (DistSquared < BestDistSquared)
+		{
+			BestDistSquared = DistSquared;
+			OutCoords = FIntPoint(X, Y);
+		}
+	}
+
+	return BestDistSquared != MAX_int64;
+}
+
 // === Helper Functions ===
 
-int32 AZoneGrid::GridCoordsToIndex(int32 X, int32 Y) const
+bool AZoneGrid::TryGetResidentZoneType(int32 X, int32 Y, uint8& OutZoneType) const
 {
-	return Y * GridSizeX + X;
+	if (!IsValidGridCoords(X, Y))
+		return false;
+
+	if (bUseChunkedStorage)
+	{
+		const UZoneGridChunk* Chunk = ResidentChunks.FindRef(GetChunkIndexForCell(X, Y));
+		if (!Chunk)
+			return false;
+
+		const int32 LocalIndex = Chunk->GetLocalIndex(X % ChunkSize, Y % ChunkSize);
+		if (!Chunk->ZoneTypeLayer.IsValidIndex(LocalIndex))
+			return false;
+
+		OutZoneType = Chunk->ZoneTypeLayer[LocalIndex];
+		return true;
+	}
+
+	const int32 Index = GridCoordsToIndex(X, Y);
+	if (!ZoneTypeLayer.IsValidIndex(Index))
+		return false;
+
+	OutZoneType = ZoneTypeLayer[Index];
+	return true;
+}
+
+void AZoneGrid::InvalidateDerivedData()
+{
+	CellDataVersion++;
+
+	for (FZoneNearestField& Field : NearestZoneFields)
+	{
+		Field.Reset();
+	}
+	ChunkNearestFields.Reset();
+	for (FZoneSummedAreaTable& Table : ZoneCountTables)
+	{
+		Table.Reset();
+	}
+	RichnessSumTable.Reset();
+	ZoneRegions.Reset();
+	PathGraph.Reset();
+}
+
+void AZoneGrid::OnCellsChanged(const TArray<int32>& ChangedIndices)
+{
+	CellDataVersion++;
+
+	for (FZoneNearestField& Field : NearestZoneFields)
+	{
+		Field.UpdateChangedCells(ZoneTypeLayer, ChangedIndices);
+	}
+	for (FZoneSummedAreaTable& Table : ZoneCountTables)
+	{
+		Table.UpdateChangedCells(ZoneTypeLayer, ChangedIndices);
+	}
+	ZoneRegions.UpdateChangedCells(ZoneTypeLayer, RichnessLayer, ChangedIndices);
+	PathGraph.UpdateChangedCells(ZoneTypeLayer, ChangedIndices);
+}
+
+float AZoneGrid::GetZoneTraversalCost(ETerrainZone ZoneType) const
+{
+	const float* Cost = ZoneTraversalCosts.Find(ZoneType);
+	return Cost ? FMath::Max(*Cost, 0.0f) : 1.0f;
+}
+
+void AZoneGrid::GetZoneStepCosts(TArray<uint32>& OutStepCosts) const
+{
+	const int32 NumZoneTypes = StaticEnum<ETerrainZone>()->GetMaxEnumValue();
+	OutStepCosts.SetNumZeroed(NumZoneTypes);
+
+	for (int32 ZoneIndex = 0; ZoneIndex < NumZoneTypes; ZoneIndex++)
+	{
+		const float Cost = GetZoneTraversalCost(static_cast<ETerrainZone>(ZoneIndex));
+		OutStepCosts[ZoneIndex] = Cost > 0.0f ? FMath::Max(FMath::RoundToInt(Cost * 10.0f), 1) : 0;
+	}
+}
+
+bool AZoneGrid::FindPath(FVector Start, FVector End, TArray<FVector>& OutWaypoints) const
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_ZoneGrid_FindPath);
+
+	OutWaypoints.Reset();
+
+	// Path graph needs monolithic cell data
+	if (bUseChunkedStorage || ZoneTypeLayer.Num() != GetTotalCells())
+		return false;
+
+	const FIntPoint StartCoords = WorldToGridCoords(Start);
+	const FIntPoint EndCoords = WorldToGridCoords(End);
+	if (!IsValidGridCoords(StartCoords.X, StartCoords.Y) || !IsValidGridCoords(EndCoords.X, EndCoords.Y))
+		return false;
+
+	if (!PathGraph.IsBuilt())
+	{
+		QUICK_SCOPE_CYCLE_COUNTER(STAT_ZoneGrid_BuildPathGraph);
+
+		TArray<uint32> StepCosts;
+		GetZoneStepCosts(StepCosts);
+		PathGraph.Build(ZoneTypeLayer, GridSizeX, GridSizeY, StepCosts, PathClusterSize);
+	}
+
+	TArray<int32> Cells;
+	if (!PathGraph.FindPath(ZoneTypeLayer, GridCoordsToIndex(StartCoords.X, StartCoords.Y), GridCoordsToIndex(EndCoords.X, EndCoords.Y), Cells))
+		return false;
+
+	// Keep only cells where the heading changes (skip the start cell, End replaces the goal cell)
+	for (int32 Step = 1; Step < Cells.Num() - 1; Step++)
+	{
+		const int32 Prev = Cells[Step - 1];
+		const int32 Cell = Cells[Step];
+		const int32 Next = Cells[Step + 1];
+		const bool bSameHeading =
+			(Cell % GridSizeX - Prev % GridSizeX) == (Next % GridSizeX - Cell % GridSizeX) &&
+			(Cell / GridSizeX - Prev / GridSizeX) == (Next / GridSizeX - Cell / GridSizeX);
+		if (bSameHeading)
+			continue;
+
+		FVector Waypoint = GridCoordsToWorld(Cell % GridSizeX, Cell / GridSizeX);
+		Waypoint.Z = FMath::Lerp(Start.Z, End.Z, static_cast<float>(Step) / (Cells.Num() - 1));
+		OutWaypoints.Add(Waypoint);
+	}
+	OutWaypoints.Add(End);
+
+	return true;
 }
 
 bool AZoneGrid::IsValidGridCoords(int32 X, int32 Y) const
@@ -352,7 +1768,7 @@ float AZoneGrid::GetTerrainHeight(FVector Location) const
 	return Location.Z;
 }
 
-ETerrainZone AZoneGrid::DetermineZoneType(FVector Location, float Height) const
+ETerrainZone AZoneGrid::DetermineZoneType(FVector Location, float Height, FSimRandomStream& RandomStream) const
 {
 	// Water check
 	if (Height < WaterHeightMax)
@@ -367,7 +1783,7 @@ ETerrainZone AZoneGrid::DetermineZoneType(FVector Location, float Height) const
 	}
 
 	// Random forest distribution on flat land
-	float RandomValue = FMath::FRand();
+	float RandomValue = RandomStream.FRand();
 	if (RandomValue < ForestProbability)
 	{
 		return ETerrainZone::Forest;
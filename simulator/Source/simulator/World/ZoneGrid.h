@@ -4,12 +4,23 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "Engine/StreamableManager.h"
 #include "SimulatorTypes.h"
+#include "ZoneNearestField.h"
+#include "ZoneRegionLabels.h"
+#include "ZoneSummedAreaTable.h"
+#include "ZoneHierarchicalPathfinder.h"
+#include "SimRandomStream.h"
+#include "ZoneGridChunk.h"
 #include "ZoneGrid.generated.h"
 
+class UZoneGridOverlayComponent;
+
 /**
  * Single cell data in the zone grid
- * Stores zone type, position, and optional properties
+ * Unpacked view of one cell returned by the query API.
+ * The grid itself stores cells in packed per-layer arrays; coordinates and
+ * world position are derived from the cell index on demand.
  */
 USTRUCT(BlueprintType)
 struct FZoneCellData
@@ -42,13 +53,62 @@ struct FZoneCellData
 	{}
 };
 
+/**
+ * Connected region of equal zone type
+ * Snapshot returned by region queries. RegionId is only stable until the
+ * next paint edit (regions merge and split as cells are repainted).
+ */
+USTRUCT(BlueprintType)
+struct FZoneRegionInfo
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Zone Region")
+	int32 RegionId = INDEX_NONE;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Zone Region")
+	ETerrainZone ZoneType = ETerrainZone::Farmland;
+
+	// Number of cells in the region
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Zone Region")
+	int32 CellCount = 0;
+
+	// Inclusive grid bounds
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Zone Region")
+	FIntPoint BoundsMin = FIntPoint(0, 0);
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Zone Region")
+	FIntPoint BoundsMax = FIntPoint(0, 0);
+
+	// World position of the mean cell center (may lie outside concave regions)
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Zone Region")
+	FVector Centroid = FVector::ZeroVector;
+
+	// Sum of authored cell richness (1.0 per full cell)
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Zone Region")
+	float RichnessSum = 0.0f;
+};
+
 /**
  * Data-driven Zone Grid System
  * Single actor manages entire zone grid as a data structure
  *
  * Features:
- * - TArray-based cell storage (efficient for large maps)
- * - Editor visualization with color-coded cells
+ * - Packed layer storage: one byte per cell for zone type, one byte for
+ *   quantized richness (2 bytes/cell, 2000x2000 grid = ~8MB)
+ * - Legacy FZoneCellData arrays are migrated on load
+ * - Compact on-disk format: run-length encoded layers behind a custom
+ *   version, plus optional standalone .zonegrid files (memory-mapped load)
+ * - Per-zone-type nearest-cell fields for O(1) "nearest Forest" lookups
+ * - Summed-area tables for O(1) rectangle counts and multi-cell footprint checks
+ * - Connected-region labels with area/bounds/centroid/richness per region,
+ *   relabeled locally on paint
+ * - Batched per-turn resource depletion and regrowth on a byte layer
+ * - Optional chunked mode: grid split into UZoneGridChunk assets that stream
+ *   around active territories and the camera (resident memory scales with
+ *   the active area; whole-grid derived data is monolithic-mode only)
+ * - Texture overlay visualization (one texel per cell, dirty-rect uploads),
+ *   usable in editor and at runtime; debug-draw fallback without a material
  * - Paint-brush editing capability
  * - Automatic world position calculation
  * - Building placement constraint queries
@@ -63,6 +123,9 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void PostLoad() override;
+	virtual void Serialize(FArchive& Ar) override;
 
 #if WITH_EDITOR
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
@@ -72,10 +135,10 @@ public:
 	// === Grid Settings ===
 
 	// Grid dimensions (number of cells)
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grid Settings", meta = (ClampMin = "1", ClampMax = "500"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grid Settings", meta = (ClampMin = "1", ClampMax = "4096"))
 	int32 GridSizeX = 100;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grid Settings", meta = (ClampMin = "1", ClampMax = "500"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grid Settings", meta = (ClampMin = "1", ClampMax = "4096"))
 	int32 GridSizeY = 100;
 
 	// Size of each cell in world units (cm)
@@ -88,9 +151,61 @@ public:
 
 	// === Zone Data ===
 
-	// All cell data (GridSizeX * GridSizeY elements)
+	// Legacy per-cell storage (pre packed layers), migrated in PostLoad
+	UPROPERTY()
+	TArray<FZoneCellData> ZoneCells_DEPRECATED;
+
+	// Standalone .zonegrid file (relative to the project Content dir), loaded when the level carries no cell data
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Zone Data")
-	TArray<FZoneCellData> ZoneCells;
+	FString ExternalDataFile;
+
+	// Decode the external file straight from a memory mapping instead of reading it into a buffer
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Zone Data")
+	bool bMemoryMapExternalData = true;
+
+	// Load cell layers from a standalone .zonegrid file (adopts the file's grid size)
+	UFUNCTION(BlueprintCallable, Category = "Zone Grid")
+	bool LoadFromZoneGridFile(const FString& FilePath);
+
+	// Write cell layers to a standalone .zonegrid file
+	UFUNCTION(BlueprintCallable, Category = "Zone Grid")
+	bool SaveToZoneGridFile(const FString& FilePath) const;
+
+	// === Chunked Storage ===
+
+	// Store cells in streamed chunk assets instead of the actor itself
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Chunked Storage")
+	bool bUseChunkedStorage = false;
+
+	// Cells per chunk side (fixed once exported)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Chunked Storage", meta = (ClampMin = "8", ClampMax = "512", EditCondition = "!bUseChunkedStorage"))
+	int32 ChunkSize = 64;
+
+	// Package folder for exported chunk assets
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Chunked Storage")
+	FString ChunkAssetPath = TEXT("/Game/ZoneGrid");
+
+	// Chunk assets (NumChunksX * NumChunksY, row-major), filled by ExportToChunks
+	UPROPERTY(EditAnywhere, Category = "Chunked Storage", meta = (EditCondition = "bUseChunkedStorage"))
+	TArray<TSoftObjectPtr<UZoneGridChunk>> ChunkAssets;
+
+	// Extra distance around territories and camera to keep chunks resident (cm)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Chunked Storage", meta = (EditCondition = "bUseChunkedStorage"))
+	float ChunkStreamingRadius = 50000.0f;
+
+	// How often to re-evaluate resident chunks (seconds)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Chunked Storage", meta = (EditCondition = "bUseChunkedStorage"))
+	float ChunkStreamingInterval = 1.0f;
+
+	// === Resource Depletion ===
+
+	// Richness removed per gathered resource unit (0.01 = 100 units empty a full cell)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Resources", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float DepletionPerUnit = 0.01f;
+
+	// Richness recovered by every depleted cell per territory turn
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Resources", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float RegrowthPerTurn = 0.05f;
 
 	// === Auto-Generation Settings ===
 
@@ -112,6 +227,35 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Auto-Generation|Thresholds", meta = (EditCondition = "bAutoDetectZoneType"))
 	float ForestProbability = 0.3f;
 
+	// Seed for random zone placement (same seed + terrain = same grid)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Auto-Generation", meta = (EditCondition = "bAutoDetectZoneType"))
+	int32 GenerationSeed = 0;
+
+	// === Movement ===
+
+	// Relative cost of crossing each zone type (0 = impassable, missing = 1.0), used by flow fields and pathfinding
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement")
+	TMap<ETerrainZone, float> ZoneTraversalCosts;
+
+	// Cluster edge length (cells) of the hierarchical path graph
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement", meta = (ClampMin = "4", ClampMax = "64"))
+	int32 PathClusterSize = 16;
+
+	// Traversal cost of a zone type (0 = impassable)
+	UFUNCTION(BlueprintCallable, Category = "Zone Grid|Movement")
+	float GetZoneTraversalCost(ETerrainZone ZoneType) const;
+
+	// Integer step cost per zone type byte (tenths, 0 = impassable)
+	void GetZoneStepCosts(TArray<uint32>& OutStepCosts) const;
+
+	// Route around impassable zones as world waypoints (cell centers, last one = End)
+	// False if either end is off-grid/impassable, unreachable, or the grid is chunked
+	UFUNCTION(BlueprintCallable, Category = "Zone Grid|Movement")
+	bool FindPath(FVector Start, FVector End, TArray<FVector>& OutWaypoints) const;
+
+	// Bumped on every cell edit so external caches can detect stale data
+	uint32 GetCellDataVersion() const { return CellDataVersion; }
+
 	// === Editor Visualization ===
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Visualization")
@@ -123,6 +267,18 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Visualization")
 	float VisualizationHeight = 100.0f; // Height offset for drawing
 
+	// Textured plane showing zone colors (needs OverlayMaterial assigned)
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Visualization")
+	UZoneGridOverlayComponent* GridOverlay;
+
+	// Rebuild overlay from current cell data (runtime and editor)
+	UFUNCTION(BlueprintCallable, Category = "Zone Grid|Visualization")
+	void RefreshGridOverlay();
+
+	// Show or hide the overlay
+	UFUNCTION(BlueprintCallable, Category = "Zone Grid|Visualization")
+	void SetGridVisualizationVisible(bool bVisible);
+
 	// === Generation Functions ===
 
 #if WITH_EDITOR
@@ -141,30 +297,86 @@ public:
 	// Visualize grid in editor
 	UFUNCTION(CallInEditor, Category = "Generation")
 	void VisualizeGrid();
+
+	// Split current cell data into chunk assets and switch to chunked storage
+	UFUNCTION(CallInEditor, Category = "Chunked Storage")
+	void ExportToChunks();
+
+	// Load all chunk assets back into the actor and switch to monolithic storage
+	UFUNCTION(CallInEditor, Category = "Chunked Storage")
+	void ImportFromChunks();
+
+	// Write current cells to ExternalDataFile
+	UFUNCTION(CallInEditor, Category = "Zone Data")
+	void ExportExternalDataFile();
 #endif
 
 	// === Query Functions (Runtime & Editor) ===
 
-	// Get zone type at world location
+	// Get zone type at world location (Farmland if unknown - see TryGetZoneTypeAtLocation)
 	UFUNCTION(BlueprintCallable, Category = "Zone Grid")
 	ETerrainZone GetZoneTypeAtLocation(FVector WorldLocation) const;
 
-	// Get zone type at grid coordinates
+	// Get zone type at grid coordinates (Farmland if unknown - see TryGetZoneTypeAtGridCoords)
 	UFUNCTION(BlueprintCallable, Category = "Zone Grid")
 	ETerrainZone GetZoneTypeAtGridCoords(int32 X, int32 Y) const;
 
+	// Get zone type at world location (false if outside the grid, or not streamed in yet in chunked mode)
+	UFUNCTION(BlueprintCallable, Category = "Zone Grid")
+	bool TryGetZoneTypeAtLocation(FVector WorldLocation, ETerrainZone& OutZoneType) const;
+
+	// Get zone type at grid coordinates (false if outside the grid, or not streamed in yet in chunked mode)
+	UFUNCTION(BlueprintCallable, Category = "Zone Grid")
+	bool TryGetZoneTypeAtGridCoords(int32 X, int32 Y, ETerrainZone& OutZoneType) const;
+
 	// Get cell data at location
 	UFUNCTION(BlueprintCallable, Category = "Zone Grid")
 	bool GetCellAtLocation(FVector WorldLocation, FZoneCellData& OutCell) const;
 
-	// Get cell data at grid coordinates
+	// Get cell data at grid coordinates (false if outside the grid, or not streamed in yet in chunked mode)
 	UFUNCTION(BlueprintCallable, Category = "Zone Grid")
 	bool GetCellAtGridCoords(int32 X, int32 Y, FZoneCellData& OutCell) const;
 
+	// Find center of the nearest cell of a zone type (O(1) once the field is built)
+	UFUNCTION(BlueprintCallable, Category = "Zone Grid")
+	bool FindNearestZoneCell(FVector FromLocation, ETerrainZone ZoneType, FVector& OutLocation) const;
+
+	// Connected region containing a location (monolithic mode only)
+	UFUNCTION(BlueprintCallable, Category = "Zone Grid|Regions")
+	bool GetRegionAtLocation(FVector WorldLocation, FZoneRegionInfo& OutRegion) const;
+
+	// Region id at grid coordinates (INDEX_NONE if unavailable)
+	UFUNCTION(BlueprintCallable, Category = "Zone Grid|Regions")
+	int32 GetRegionIdAtGridCoords(int32 X, int32 Y) const;
+
+	// Stats of a region by id (fails for ids invalidated by later edits)
+	UFUNCTION(BlueprintCallable, Category = "Zone Grid|Regions")
+	bool GetRegionInfo(int32 RegionId, FZoneRegionInfo& OutRegion) const;
+
+	// Number of connected regions across all zone types
+	UFUNCTION(BlueprintCallable, Category = "Zone Grid|Regions")
+	int32 GetRegionCount() const;
+
 	// Check if location is valid for building type
 	UFUNCTION(BlueprintCallable, Category = "Zone Grid")
 	bool CanBuildAtLocation(FVector WorldLocation, ETerrainZone RequiredZoneType) const;
 
+	// Count cells of a zone type in an inclusive grid rectangle (clamped; O(1) in monolithic mode)
+	UFUNCTION(BlueprintCallable, Category = "Zone Grid|Footprint")
+	int32 CountZoneCellsInRect(FIntPoint MinCoords, FIntPoint MaxCoords, ETerrainZone ZoneType) const;
+
+	// Mean authored richness in an inclusive grid rectangle (clamped; O(1) in monolithic mode)
+	UFUNCTION(BlueprintCallable, Category = "Zone Grid|Footprint")
+	float GetMeanRichnessInRect(FIntPoint MinCoords, FIntPoint MaxCoords) const;
+
+	// Grid cells overlapped by a rotated footprint (axis-aligned bounds of the rotated rectangle)
+	UFUNCTION(BlueprintCallable, Category = "Zone Grid|Footprint")
+	void GetFootprintCellBounds(FVector Center, FRotator Rotation, FVector2D FootprintSize, FIntPoint& OutMinCoords, FIntPoint& OutMaxCoords) const;
+
+	// Check that at least MinCoverage of the footprint cells have the required zone type (fails outside the grid)
+	UFUNCTION(BlueprintCallable, Category = "Zone Grid|Footprint")
+	bool CanBuildFootprint(FVector Center, FRotator Rotation, FVector2D FootprintSize, ETerrainZone RequiredZoneType, float MinCoverage = 1.0f) const;
+
 	// Get grid coordinates from world location
 	UFUNCTION(BlueprintCallable, Category = "Zone Grid")
 	FIntPoint WorldToGridCoords(FVector WorldLocation) const;
@@ -177,24 +389,192 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Zone Grid")
 	int32 GetTotalCells() const { return GridSizeX * GridSizeY; }
 
+	// Get resource richness (0.0 - 1.0) at grid coordinates
+	UFUNCTION(BlueprintCallable, Category = "Zone Grid")
+	float GetResourceRichnessAtGridCoords(int32 X, int32 Y) const;
+
+	// Get richness left at location after this turn's queued gathers (0.0 - 1.0)
+	UFUNCTION(BlueprintCallable, Category = "Zone Grid|Resources")
+	float GetAvailableRichnessAtLocation(FVector WorldLocation) const;
+
+	// Record a gather; depletion is applied in batch by ProcessResourceTurn
+	UFUNCTION(BlueprintCallable, Category = "Zone Grid|Resources")
+	void QueueGatherEvent(FVector WorldLocation, int32 Amount);
+
+	// Apply all queued gathers, then regrow depleted cells (once per territory turn)
+	UFUNCTION(BlueprintCallable, Category = "Zone Grid|Resources")
+	void ProcessResourceTurn();
+
+	// Has the grid been initialized with cell data?
+	UFUNCTION(BlueprintCallable, Category = "Zone Grid")
+	bool HasCellData() const { return bUseChunkedStorage ? ChunkAssets.Num() > 0 : ZoneTypeLayer.Num() > 0; }
+
+	// === Chunk Streaming ===
+
+	// Number of chunks along each axis
+	int32 GetNumChunksX() const { return FMath::DivideAndRoundUp(GridSizeX, ChunkSize); }
+	int32 GetNumChunksY() const { return FMath::DivideAndRoundUp(GridSizeY, ChunkSize); }
+
+	// Number of chunks currently in memory
+	UFUNCTION(BlueprintCallable, Category = "Zone Grid|Streaming")
+	int32 GetResidentChunkCount() const { return ResidentChunks.Num(); }
+
+	// Re-evaluate which chunks should be resident (runs on a timer in chunked mode)
+	UFUNCTION(BlueprintCallable, Category = "Zone Grid|Streaming")
+	void UpdateChunkStreaming();
+
+	// Add a streaming focus point for this update cycle (e.g. a caravan destination)
+	UFUNCTION(BlueprintCallable, Category = "Zone Grid|Streaming")
+	void AddStreamingSource(FVector WorldLocation, float Radius);
+
+	// === Packed Layer Access (for full-grid scans, monolithic mode only) ===
+
+	// Zone type per cell (ETerrainZone as uint8), indexed by GridCoordsToIndex
+	const TArray<uint8>& GetZoneTypeLayer() const { return ZoneTypeLayer; }
+
+	// Quantized richness per cell (0 = 0.0, 255 = 1.0), indexed by GridCoordsToIndex
+	const TArray<uint8>& GetRichnessLayer() const { return RichnessLayer; }
+
+	// Convert 2D grid coords to 1D array index
+	int32 GridCoordsToIndex(int32 X, int32 Y) const { return Y * GridSizeX + X; }
+
+	// Convert 1D array index back to grid coords
+	FIntPoint IndexToGridCoords(int32 Index) const { return FIntPoint(Index % GridSizeX, Index / GridSizeX); }
+
+	// Check if grid coordinates are valid
+	bool IsValidGridCoords(int32 X, int32 Y) const;
+
+	// Read zone type only if the cell is in memory (never triggers a chunk load)
+	bool TryGetResidentZoneType(int32 X, int32 Y, uint8& OutZoneType) const;
+
+	// Get color for zone type (for visualization)
+	FColor GetZoneColor(ETerrainZone ZoneType) const;
+
+	// Richness quantization helpers (8-bit fixed point)
+	static uint8 QuantizeRichness(float Richness) { return static_cast<uint8>(FMath::RoundToInt(FMath::Clamp(Richness, 0.0f, 1.0f) * 255.0f)); }
+	static float DequantizeRichness(uint8 Quantized) { return Quantized * (1.0f / 255.0f); }
+
+	// Authored richness minus runtime depletion (both quantized)
+	static uint8 ApplyDepletion(uint8 Richness, uint8 Depletion) { return Richness > Depletion ? Richness - Depletion : 0; }
+
 	// === Editor Paint Functions ===
 
 	// Paint zone type in area (used by Editor Mode Plugin)
 	void PaintZoneArea(FVector WorldLocation, int32 BrushRadius, ETerrainZone ZoneType);
 
 protected:
-	// Convert 2D grid coords to 1D array index
-	int32 GridCoordsToIndex(int32 X, int32 Y) const;
+	// Packed zone type layer (GridSizeX * GridSizeY bytes, row-major), saved run-length encoded in Serialize
+	TArray<uint8> ZoneTypeLayer;
 
-	// Check if grid coordinates are valid
-	bool IsValidGridCoords(int32 X, int32 Y) const;
+	// Packed resource richness layer (GridSizeX * GridSizeY bytes, row-major), saved run-length encoded in Serialize
+	TArray<uint8> RichnessLayer;
+
+	// Runtime depletion per cell (0 = untouched), subtracted from RichnessLayer on read
+	UPROPERTY(Transient)
+	TArray<uint8> DepletionLayer;
+
+	// Gathered units per cell index since the last resource turn
+	TMap<int32, int32> PendingGatherUnits;
+
+	// Allocate packed layers for the current grid size, filled with the given zone type
+	void AllocateLayers(ETerrainZone FillZoneType);
+
+	// Convert legacy ZoneCells_DEPRECATED into packed layers
+	void MigrateLegacyCells();
+
+	// Resolve ExternalDataFile to an absolute path
+	FString GetExternalDataFilePath() const;
+
+	// Nearest-cell field per zone type (indexed by ETerrainZone), built lazily on first query
+	mutable TArray<FZoneNearestField> NearestZoneFields;
+
+	// Connected-region labels, built lazily on first query
+	mutable FZoneRegionLabels ZoneRegions;
 
-	// Get terrain height at location (for auto-generation)
+	// Build region labels if needed (false without monolithic cell data)
+	bool EnsureRegionLabels() const;
+
+	// Cell-count tables per zone type (indexed by ETerrainZone), built lazily on first query
+	mutable TArray<FZoneSummedAreaTable> ZoneCountTables;
+
+	// Richness sum table, built lazily on first query
+	mutable FZoneSummedAreaTable RichnessSumTable;
+
+	// Cluster graph for FindPath, built lazily on first query
+	mutable FZoneHierarchicalPathfinder PathGraph;
+
+	// Cell edit counter (see GetCellDataVersion)
+	uint32 CellDataVersion = 0;
+
+	// Drop all derived data after bulk edits (fields rebuild lazily)
+	void InvalidateDerivedData();
+
+	// Patch derived data after individual cells changed zone type
+	void OnCellsChanged(const TArray<int32>& ChangedIndices);
+
+	// === Chunk Storage ===
+
+	// Loaded chunks by chunk index
+	TMap<int32, UZoneGridChunk*> ResidentChunks;
+
+	// Streaming handles keeping chunks loaded (entries without a resident chunk are in flight)
+	TMap<int32, TSharedPtr<FStreamableHandle>> ChunkHandles;
+
+	FStreamableManager ChunkStreamableManager;
+
+	// Chunks read while not resident, by last read time - the next streaming update loads them asynchronously
+	mutable TMap<int32, double> OnDemandChunkRequests;
+
+	// Nearest-cell fields per resident chunk (indexed by ETerrainZone), built lazily on first query
+	mutable TMap<int32, TArray<FZoneNearestField>> ChunkNearestFields;
+
+	// Runtime edits of chunks that were unloaded, by chunk index (restored when they load again)
+	TMap<int32, FZoneGridChunkEdits> ChunkEdits;
+
+	// Move a modified chunk's runtime edits into ChunkEdits before it unloads
+	void StashChunkEdits(int32 ChunkIndex, UZoneGridChunk* Chunk);
+
+	// Reapply stashed edits to a chunk that just became resident
+	void RestoreChunkEdits(int32 ChunkIndex, UZoneGridChunk* Chunk);
+
+	// Extra focus points registered since the last streaming update
+	TArray<FSphere> ExtraStreamingSources;
+
+	FTimerHandle ChunkStreamingTimerHandle;
+
+	// Find chunk holding a cell, outputs index within the chunk. Never blocks in game worlds:
+	// a chunk that isn't in memory returns nullptr and is queued for async load.
+	UZoneGridChunk* GetChunkForCell(int32 X, int32 Y, int32& OutLocalIndex) const;
+
+	// Find chunk holding a cell, loading synchronously on miss (edits only - reads use GetChunkForCell)
+	UZoneGridChunk* LoadChunkForCell(int32 X, int32 Y, int32& OutLocalIndex);
+
+	// Queue a chunk for the next streaming update
+	void RequestChunkLoad(int32 ChunkIndex) const;
+
+	// Nearest-cell field for one resident chunk (chunk-local indices)
+	const FZoneNearestField& GetChunkNearestField(int32 ChunkIndex, uint8 ZoneType) const;
+
+	// Chunk index for grid coordinates
+	int32 GetChunkIndexForCell(int32 X, int32 Y) const { return (Y / ChunkSize) * GetNumChunksX() + (X / ChunkSize); }
+
+	// Cell rectangle covered by a chunk
+	FIntRect GetChunkCellRect(int32 ChunkIndex) const;
+
+	// Async load completion
+	void OnChunkLoaded(int32 ChunkIndex);
+
+	// Nearest-zone search restricted to resident chunks (chunked mode, per-chunk fields)
+	bool FindNearestZoneCellInResidentChunks(FIntPoint FromCoords, uint8 ZoneType, FIntPoint& OutCoords) const;
+
+#if WITH_EDITOR
+	// Sample terrain and classify every cell (parallel row batches, with progress dialog)
+	void GenerateZoneTypes(TArray<uint8>& OutZoneTypes) const;
+#endif
+
+	// Get terrain height at location (for auto-generation, safe to call from worker threads)
 	float GetTerrainHeight(FVector Location) const;
 
 	// Determine zone type from height (for auto-generation)
-	ETerrainZone DetermineZoneType(FVector Location, float Height) const;
-
-	// Get color for zone type (for visualization)
-	FColor GetZoneColor(ETerrainZone ZoneType) const;
+	ETerrainZone DetermineZoneType(FVector Location, float Height, FSimRandomStream& RandomStream) const;
 };
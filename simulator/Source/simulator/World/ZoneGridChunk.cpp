@@ -0,0 +1,19 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ZoneGridChunk.h"
+#include "ZoneGridSerialization.h"
+
+void UZoneGridChunk::Serialize(FArchive& Ar)
+{
+	Super::Serialize(Ar);
+
+	Ar.UsingCustomVersion(FZoneGridCustomVersion::GUID);
+
+	if (Ar.IsObjectReferenceCollector())
+		return;
+
+	if (Ar.IsLoading() && Ar.CustomVer(FZoneGridCustomVersion::GUID) < FZoneGridCustomVersion::CompactCellData)
+		return;
+
+	ZoneGridSerialization::SerializeLayers(Ar, ZoneTypeLayer, RichnessLayer);
+}
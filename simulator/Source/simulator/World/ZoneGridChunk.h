@@ -0,0 +1,62 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "ZoneGridChunk.generated.h"
+
+/**
+ * Runtime edits of an unloaded chunk, kept by the grid and reapplied when the chunk loads again
+ */
+struct FZoneGridChunkEdits
+{
+	// Painted zone types (empty if only depletion changed)
+	TArray<uint8> ZoneTypeLayer;
+
+	// Depletion per cell (keeps regrowing while the chunk is unloaded)
+	TArray<uint8> DepletionLayer;
+};
+
+/**
+ * One fixed-size tile of a chunked ZoneGrid
+ * Stored as its own asset so the grid can stream tiles in and out
+ * around active territories and the camera.
+ *
+ * Layers use the same packed format as AZoneGrid (row-major, ChunkSize x ChunkSize);
+ * edge chunks are padded to the full size, and saved run-length encoded.
+ */
+UCLASS(BlueprintType)
+class SIMULATOR_API UZoneGridChunk : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Serialize(FArchive& Ar) override;
+
+	// Chunk coordinates within the owning grid (in chunks, not cells)
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Zone Chunk")
+	FIntPoint ChunkCoords = FIntPoint(0, 0);
+
+	// Cells per chunk side
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Zone Chunk")
+	int32 ChunkSize = 64;
+
+	// Zone type per cell (ETerrainZone as uint8)
+	TArray<uint8> ZoneTypeLayer;
+
+	// Quantized richness per cell (0 = 0.0, 255 = 1.0)
+	TArray<uint8> RichnessLayer;
+
+	// Runtime depletion per cell (not saved), allocated on first gather
+	TArray<uint8> DepletionLayer;
+
+	// Changed at runtime since load (painted or gathered from) - edits are stashed by the grid on unload
+	bool bModified = false;
+
+	// Zone types were painted since load (the zone layer has to be stashed, not just depletion)
+	bool bZoneTypeModified = false;
+
+	// Convert cell offset inside the chunk to layer index
+	int32 GetLocalIndex(int32 LocalX, int32 LocalY) const { return LocalY * ChunkSize + LocalX; }
+};
@@ -0,0 +1,138 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ZoneGridOverlayComponent.h"
+#include "ZoneGrid.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/Texture2D.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "UObject/ConstructorHelpers.h"
+
+UZoneGridOverlayComponent::UZoneGridOverlayComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+
+	// Engine plane is 100x100 units centered on its origin
+	static ConstructorHelpers::FObjectFinder<UStaticMesh> PlaneMesh(TEXT("/Engine/BasicShapes/Plane"));
+	if (PlaneMesh.Succeeded())
+	{
+		SetStaticMesh(PlaneMesh.Object);
+	}
+
+	SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	SetCastShadow(false);
+	SetUsingAbsoluteLocation(true);
+	SetUsingAbsoluteRotation(true);
+	SetUsingAbsoluteScale(true);
+	SetVisibility(false);
+
+	OverlayMaterial = nullptr;
+	TextureParameterName = FName("ZoneTexture");
+	CellOpacity = 0.6f;
+
+	ZoneTexture = nullptr;
+	OverlayMaterialInstance = nullptr;
+	TextureSize = FIntPoint::ZeroValue;
+}
+
+void UZoneGridOverlayComponent::RebuildOverlay(const AZoneGrid* Grid)
+{
+	if (!Grid || !CanDisplay() || Grid->GridSizeX <= 0 || Grid->GridSizeY <= 0)
+	{
+		ClearOverlay();
+		return;
+	}
+
+	// Recreate texture only when grid size changed
+	const FIntPoint NewSize(Grid->GridSizeX, Grid->GridSizeY);
+	if (!ZoneTexture || TextureSize != NewSize)
+	{
+		ZoneTexture = UTexture2D::CreateTransient(NewSize.X, NewSize.Y, PF_B8G8R8A8);
+		if (!ZoneTexture)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("ZoneGridOverlay: Failed to create %dx%d texture"), NewSize.X, NewSize.Y);
+			return;
+		}
+
+		ZoneTexture->Filter = TF_Nearest;
+		ZoneTexture->SRGB = true;
+		ZoneTexture->AddressX = TA_Clamp;
+		ZoneTexture->AddressY = TA_Clamp;
+		ZoneTexture->UpdateResource();
+		TextureSize = NewSize;
+	}
+
+	if (!OverlayMaterialInstance || OverlayMaterialInstance->Parent != OverlayMaterial)
+	{
+		OverlayMaterialInstance = UMaterialInstanceDynamic::Create(OverlayMaterial, this);
+	}
+	OverlayMaterialInstance->SetTextureParameterValue(TextureParameterName, ZoneTexture);
+	SetMaterial(0, OverlayMaterialInstance);
+
+	UpdatePlaneTransform(Grid);
+	UpdateCells(Grid, FIntRect(0, 0, TextureSize.X, TextureSize.Y));
+	SetVisibility(true);
+}
+
+void UZoneGridOverlayComponent::UpdateCells(const AZoneGrid* Grid, const FIntRect& CellRect)
+{
+	if (!Grid || !ZoneTexture)
+		return;
+
+	// Clip to texture
+	const int32 MinX = FMath::Clamp(CellRect.Min.X, 0, TextureSize.X);
+	const int32 MinY = FMath::Clamp(CellRect.Min.Y, 0, TextureSize.Y);
+	const int32 MaxX = FMath::Clamp(CellRect.Max.X, 0, TextureSize.X);
+	const int32 MaxY = FMath::Clamp(CellRect.Max.Y, 0, TextureSize.Y);
+	const int32 Width = MaxX - MinX;
+	const int32 Height = MaxY - MinY;
+	if (Width <= 0 || Height <= 0)
+		return;
+
+	// Region buffer is owned by the render command and freed once uploaded
+	FColor* Pixels = new FColor[Width * Height];
+	const uint8 Alpha = static_cast<uint8>(FMath::RoundToInt(CellOpacity * 255.0f));
+
+	for (int32 Y = 0; Y < Height; Y++)
+	{
+		for (int32 X = 0; X < Width; X++)
+		{
+			uint8 ZoneTypeByte = 0;
+			FColor& Pixel = Pixels[Y * Width + X];
+			if (Grid->TryGetResidentZoneType(MinX + X, MinY + Y, ZoneTypeByte))
+			{
+				Pixel = Grid->GetZoneColor(static_cast<ETerrainZone>(ZoneTypeByte));
+				Pixel.A = Alpha;
+			}
+			else
+			{
+				// Unloaded or uninitialized cell - fully transparent
+				Pixel = FColor(0, 0, 0, 0);
+			}
+		}
+	}
+
+	FUpdateTextureRegion2D* Region = new FUpdateTextureRegion2D(MinX, MinY, 0, 0, Width, Height);
+	ZoneTexture->UpdateTextureRegions(0, 1, Region, Width * sizeof(FColor), sizeof(FColor),
+		reinterpret_cast<uint8*>(Pixels),
+		[](uint8* SrcData, const FUpdateTextureRegion2D* Regions)
+		{
+			delete[] reinterpret_cast<FColor*>(SrcData);
+			delete Regions;
+		});
+}
+
+void UZoneGridOverlayComponent::ClearOverlay()
+{
+	ZoneTexture = nullptr;
+	TextureSize = FIntPoint::ZeroValue;
+	SetVisibility(false);
+}
+
+void UZoneGridOverlayComponent::UpdatePlaneTransform(const AZoneGrid* Grid)
+{
+	const FVector GridExtent(Grid->GridSizeX * Grid->CellSize, Grid->GridSizeY * Grid->CellSize, 0.0f);
+	const FVector Center = Grid->GridOrigin + GridExtent * 0.5f + FVector(0.0f, 0.0f, Grid->VisualizationHeight);
+
+	SetWorldLocationAndRotation(Center, FRotator::ZeroRotator);
+	SetWorldScale3D(FVector(GridExtent.X / 100.0f, GridExtent.Y / 100.0f, 1.0f));
+}
@@ -0,0 +1,70 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/StaticMeshComponent.h"
+#include "ZoneGridOverlayComponent.generated.h"
+
+class AZoneGrid;
+class UTexture2D;
+class UMaterialInstanceDynamic;
+
+/**
+ * Zone grid overlay drawn as a single textured plane
+ * One texel per cell, colored by zone type. Edits upload only the
+ * changed rectangle of the texture, so painting stays interactive on
+ * large grids and the overlay can be shown at runtime.
+ *
+ * OverlayMaterial should be an unlit (translucent or masked) material
+ * sampling a texture parameter named TextureParameterName with the
+ * plane's UVs (U along grid X, V along grid Y).
+ */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class SIMULATOR_API UZoneGridOverlayComponent : public UStaticMeshComponent
+{
+	GENERATED_BODY()
+
+public:
+	UZoneGridOverlayComponent();
+
+	// Material used to display the zone texture
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Zone Overlay")
+	UMaterialInterface* OverlayMaterial;
+
+	// Texture parameter in OverlayMaterial that receives the zone texture
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Zone Overlay")
+	FName TextureParameterName;
+
+	// Opacity written to texel alpha for cells with data
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Zone Overlay", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float CellOpacity;
+
+	// Can the overlay be used (material assigned)?
+	bool CanDisplay() const { return OverlayMaterial != nullptr; }
+
+	// Is the overlay texture built and in sync with the grid?
+	bool IsOverlayActive() const { return ZoneTexture != nullptr; }
+
+	// Recreate texture for the current grid size and upload every cell
+	void RebuildOverlay(const AZoneGrid* Grid);
+
+	// Upload only the given cell rectangle (inclusive min, exclusive max)
+	void UpdateCells(const AZoneGrid* Grid, const FIntRect& CellRect);
+
+	// Release texture and hide the plane
+	void ClearOverlay();
+
+protected:
+	// Position and scale the plane over the grid
+	void UpdatePlaneTransform(const AZoneGrid* Grid);
+
+	UPROPERTY(Transient)
+	UTexture2D* ZoneTexture;
+
+	UPROPERTY(Transient)
+	UMaterialInstanceDynamic* OverlayMaterialInstance;
+
+	// Texture dimensions (cells)
+	FIntPoint TextureSize;
+};
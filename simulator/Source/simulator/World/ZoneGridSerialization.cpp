@@ -0,0 +1,219 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ZoneGridSerialization.h"
+#include "Serialization/CustomVersion.h"
+#include "Serialization/MemoryWriter.h"
+#include "Misc/FileHelper.h"
+#include "HAL/PlatformFileManager.h"
+#include "Async/MappedFileHandle.h"
+
+const FGuid FZoneGridCustomVersion::GUID(0x6D3A1F42, 0x9B8E4C27, 0xA51D0E93, 0x2C7F5B18);
+
+static FCustomVersionRegistration GRegisterZoneGridCustomVersion(
+	FZoneGridCustomVersion::GUID, FZoneGridCustomVersion::LatestVersion, TEXT("ZoneGridVer"));
+
+namespace ZoneGridSerialization
+{
+	namespace
+	{
+		void WriteVarInt(uint32 Value, TArray<uint8>& OutBytes)
+		{
+			while (Value >= 0x80)
+			{
+				OutBytes.Add(static_cast<uint8>(Value | 0x80));
+				Value >>= 7;
+			}
+			OutBytes.Add(static_cast<uint8>(Value));
+		}
+
+		bool ReadVarInt(const uint8* Data, int64 DataSize, int64& Offset, uint32& OutValue)
+		{
+			OutValue = 0;
+			for (int32 Shift = 0; Shift < 35; Shift += 7)
+			{
+				if (Offset >= DataSize)
+					return false;
+
+				const uint8 Byte = Data[Offset++];
+				OutValue |= static_cast<uint32>(Byte & 0x7F) << Shift;
+				if ((Byte & 0x80) == 0)
+					return true;
+			}
+			return false;
+		}
+	}
+
+	void EncodeRuns(const TArray<uint8>& Layer, TArray<uint8>& OutBytes)
+	{
+		const int32 NumCells = Layer.Num();
+		int32 RunStart = 0;
+
+		while (RunStart < NumCells)
+		{
+			const uint8 Value = Layer[RunStart];
+			int32 RunEnd = RunStart + 1;
+			while (RunEnd < NumCells && Layer[RunEnd] == Value)
+			{
+				RunEnd++;
+			}
+
+			OutBytes.Add(Value);
+			WriteVarInt(static_cast<uint32>(RunEnd - RunStart), OutBytes);
+			RunStart = RunEnd;
+		}
+	}
+
+	bool DecodeRuns(const uint8* Data, int64 DataSize, int32 NumCells, TArray<uint8>& OutLayer)
+	{
+		if (NumCells < 0 || NumCells > MaxCells || DataSize < 0)
+			return false;
+
+		// Validate the runs against the data first, so a corrupt cell count can't trigger a huge allocation
+		int64 Offset = 0;
+		int32 Counted = 0;
+		while (Counted < NumCells)
+		{
+			if (Offset >= DataSize)
+				return false;
+
+			Offset++;
+			uint32 RunLength = 0;
+			if (!ReadVarInt(Data, DataSize, Offset, RunLength) || RunLength == 0 || RunLength > static_cast<uint32>(NumCells - Counted))
+				return false;
+
+			Counted += RunLength;
+		}
+
+		if (Offset != DataSize)
+			return false;
+
+		OutLayer.SetNumUninitialized(NumCells);
+
+		Offset = 0;
+		int32 Written = 0;
+		while (Written < NumCells)
+		{
+			const uint8 Value = Data[Offset++];
+			uint32 RunLength = 0;
+			ReadVarInt(Data, DataSize, Offset, RunLength);
+
+			FMemory::Memset(OutLayer.GetData() + Written, Value, RunLength);
+			Written += RunLength;
+		}
+
+		return true;
+	}
+
+	void SerializeLayers(FArchive& Ar, TArray<uint8>& ZoneTypeLayer, TArray<uint8>& RichnessLayer)
+	{
+		int32 NumCells = ZoneTypeLayer.Num();
+		Ar << NumCells;
+
+		TArray<uint8> ZoneRuns;
+		TArray<uint8> RichnessRuns;
+
+		if (Ar.IsSaving())
+		{
+			EncodeRuns(ZoneTypeLayer, ZoneRuns);
+			EncodeRuns(RichnessLayer, RichnessRuns);
+		}
+
+		ZoneRuns.BulkSerialize(Ar);
+		RichnessRuns.BulkSerialize(Ar);
+
+		if (Ar.IsLoading())
+		{
+			if (!DecodeRuns(ZoneRuns.GetData(), ZoneRuns.Num(), NumCells, ZoneTypeLayer) ||
+				!DecodeRuns(RichnessRuns.GetData(), RichnessRuns.Num(), NumCells, RichnessLayer))
+			{
+				UE_LOG(LogTemp, Error, TEXT("ZoneGrid: Corrupt compact cell data (%d cells), discarding"), NumCells);
+				ZoneTypeLayer.Empty();
+				RichnessLayer.Empty();
+			}
+		}
+	}
+
+	bool SaveToFile(const FString& FilePath, int32 SizeX, int32 SizeY, const TArray<uint8>& ZoneTypeLayer, const TArray<uint8>& RichnessLayer)
+	{
+		TArray<uint8> ZoneRuns;
+		TArray<uint8> RichnessRuns;
+		EncodeRuns(ZoneTypeLayer, ZoneRuns);
+		EncodeRuns(RichnessLayer, RichnessRuns);
+
+		FFileHeader Header;
+		Header.SizeX = SizeX;
+		Header.SizeY = SizeY;
+		Header.ZoneRunBytes = ZoneRuns.Num();
+		Header.RichnessRunBytes = RichnessRuns.Num();
+
+		TArray<uint8> FileBytes;
+		FileBytes.Reserve(sizeof(FFileHeader) + ZoneRuns.Num() + RichnessRuns.Num());
+		FileBytes.Append(reinterpret_cast<const uint8*>(&Header), sizeof(FFileHeader));
+		FileBytes.Append(ZoneRuns);
+		FileBytes.Append(RichnessRuns);
+
+		return FFileHelper::SaveArrayToFile(FileBytes, *FilePath);
+	}
+
+	bool LoadFromFile(const FString& FilePath, bool bUseMemoryMap, int32& OutSizeX, int32& OutSizeY, TArray<uint8>& OutZoneTypeLayer, TArray<uint8>& OutRichnessLayer)
+	{
+		// Decode straight out of the mapped file when possible, otherwise read into memory
+		TUniquePtr<IMappedFileHandle> MappedHandle;
+		TUniquePtr<IMappedFileRegion> MappedRegion;
+		TArray<uint8> FileBytes;
+		const uint8* Data = nullptr;
+		int64 DataSize = 0;
+
+		if (bUseMemoryMap)
+		{
+			MappedHandle.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*FilePath));
+			if (MappedHandle)
+			{
+				MappedRegion.Reset(MappedHandle->MapRegion());
+				if (MappedRegion)
+				{
+					Data = MappedRegion->GetMappedPtr();
+					DataSize = MappedRegion->GetMappedSize();
+				}
+			}
+		}
+
+		if (!Data)
+		{
+			if (!FFileHelper::LoadFileToArray(FileBytes, *FilePath))
+				return false;
+
+			Data = FileBytes.GetData();
+			DataSize = FileBytes.Num();
+		}
+
+		if (DataSize < static_cast<int64>(sizeof(FFileHeader)))
+			return false;
+
+		FFileHeader Header;
+		FMemory::Memcpy(&Header, Data, sizeof(FFileHeader));
+
+		if (Header.Magic != FileMagic || Header.Version != FileVersion || Header.SizeX <= 0 || Header.SizeY <= 0)
+			return false;
+
+		const int64 ZoneOffset = sizeof(FFileHeader);
+		const int64 RichnessOffset = ZoneOffset + Header.ZoneRunBytes;
+		if (RichnessOffset + Header.RichnessRunBytes != DataSize)
+			return false;
+
+		// Both sizes are positive int32s, so the product can't overflow in int64
+		const int64 NumCells = static_cast<int64>(Header.SizeX) * Header.SizeY;
+		if (NumCells > MaxCells)
+			return false;
+
+		if (!DecodeRuns(Data + ZoneOffset, Header.ZoneRunBytes, static_cast<int32>(NumCells), OutZoneTypeLayer) ||
+			!DecodeRuns(Data + RichnessOffset, Header.RichnessRunBytes, static_cast<int32>(NumCells), OutRichnessLayer))
+		{
+			return false;
+		}
+
+		OutSizeX = Header.SizeX;
+		OutSizeY = Header.SizeY;
+		return true;
+	}
+}
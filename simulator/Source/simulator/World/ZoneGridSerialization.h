@@ -0,0 +1,72 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/Guid.h"
+
+/**
+ * Custom serialization version for zone grid cell data
+ */
+struct SIMULATOR_API FZoneGridCustomVersion
+{
+	enum Type
+	{
+		// Cell layers saved as tagged UPROPERTY arrays
+		BeforeCustomVersionWasAdded = 0,
+
+		// Cell layers saved as run-length encoded blobs
+		CompactCellData,
+
+		VersionPlusOne,
+		LatestVersion = VersionPlusOne - 1
+	};
+
+	static const FGuid GUID;
+};
+
+/**
+ * Compact encoding for packed zone grid layers
+ *
+ * Layers are stored as runs of (value byte, LEB128 run length). Zone types
+ * and quantized richness are painted in large uniform areas, so a typical
+ * layer shrinks by one to two orders of magnitude.
+ *
+ * Standalone .zonegrid file layout:
+ *   uint32 Magic ('ZGRD'), uint32 FileVersion, int32 SizeX, int32 SizeY,
+ *   uint32 ZoneRunBytes, uint32 RichnessRunBytes, zone runs, richness runs
+ */
+namespace ZoneGridSerialization
+{
+	static constexpr uint32 FileMagic = 0x5A475244; // 'ZGRD'
+	static constexpr uint32 FileVersion = 1;
+
+	// Largest layer accepted when loading (well above the 4096 x 4096 editor limit); guards against corrupt sizes
+	static constexpr int64 MaxCells = 16384LL * 16384LL;
+
+	// Header of a standalone .zonegrid file
+	struct FFileHeader
+	{
+		uint32 Magic = FileMagic;
+		uint32 Version = FileVersion;
+		int32 SizeX = 0;
+		int32 SizeY = 0;
+		uint32 ZoneRunBytes = 0;
+		uint32 RichnessRunBytes = 0;
+	};
+
+	// Append run-length encoded layer to OutBytes
+	SIMULATOR_API void EncodeRuns(const TArray<uint8>& Layer, TArray<uint8>& OutBytes);
+
+	// Decode exactly NumCells values from encoded runs (false on malformed data; nothing is allocated unless the runs add up)
+	SIMULATOR_API bool DecodeRuns(const uint8* Data, int64 DataSize, int32 NumCells, TArray<uint8>& OutLayer);
+
+	// Serialize a layer pair through an archive in the compact format
+	SIMULATOR_API void SerializeLayers(FArchive& Ar, TArray<uint8>& ZoneTypeLayer, TArray<uint8>& RichnessLayer);
+
+	// Write layers to a standalone file
+	SIMULATOR_API bool SaveToFile(const FString& FilePath, int32 SizeX, int32 SizeY, const TArray<uint8>& ZoneTypeLayer, const TArray<uint8>& RichnessLayer);
+
+	// Read layers from a standalone file, memory-mapping it when the platform allows
+	SIMULATOR_API bool LoadFromFile(const FString& FilePath, bool bUseMemoryMap, int32& OutSizeX, int32& OutSizeY, TArray<uint8>& OutZoneTypeLayer, TArray<uint8>& OutRichnessLayer);
+}
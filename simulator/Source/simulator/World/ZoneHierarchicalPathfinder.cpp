@@ -0,0 +1,646 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ZoneHierarchicalPathfinder.h"
+#include "Algo/Reverse.h"
+
+namespace
+{
+	const int32 NeighborOffsetsX[8] = { -1, 1, 0, 0, -1, 1, -1, 1 };
+	const int32 NeighborOffsetsY[8] = { 0, 0, -1, 1, -1, -1, 1, 1 };
+
+	// Entrance runs longer than this get a node at both ends instead of one in the middle
+	const int32 MaxSingleEntranceLength = 6;
+
+	struct FOpenNode
+	{
+		uint32 Cost;
+		int32 Id;
+	};
+
+	struct FOpenNodePredicate
+	{
+		bool operator()(const FOpenNode& A, const FOpenNode& B) const { return A.Cost < B.Cost; }
+	};
+
+	bool IsInBounds(const FIntRect& Bounds, int32 X, int32 Y)
+	{
+		return X >= Bounds.Min.X && X < Bounds.Max.X && Y >= Bounds.Min.Y && Y < Bounds.Max.Y;
+	}
+}
+
+void FZoneHierarchicalPathfinder::Build(const TArray<uint8>& ZoneTypeLayer, int32 InSizeX, int32 InSizeY, const TArray<uint32>& InStepCosts, int32 InClusterSize)
+{
+	SizeX = InSizeX;
+	SizeY = InSizeY;
+	StepCosts = InStepCosts;
+	ClusterSize = FMath::Max(InClusterSize, 2);
+
+	if (SizeX <= 0 || SizeY <= 0 || ZoneTypeLayer.Num() != SizeX * SizeY)
+	{
+		Reset();
+		return;
+	}
+
+	MinStepCost = MAX_uint32;
+	for (uint32 Cost : StepCosts)
+	{
+		if (Cost > 0)
+		{
+			MinStepCost = FMath::Min(MinStepCost, Cost);
+		}
+	}
+	if (MinStepCost == MAX_uint32)
+	{
+		MinStepCost = 1;
+	}
+
+	NumClustersX = FMath::DivideAndRoundUp(SizeX, ClusterSize);
+	NumClustersY = FMath::DivideAndRoundUp(SizeY, ClusterSize);
+	const int32 NumClusters = NumClustersX * NumClustersY;
+
+	Clusters.Reset();
+	Clusters.SetNum(NumClusters);
+	EastBorders.Reset();
+	EastBorders.SetNum(NumClusters);
+	NorthBorders.Reset();
+	NorthBorders.SetNum(NumClusters);
+
+	for (int32 ClusterIndex = 0; ClusterIndex < NumClusters; ClusterIndex++)
+	{
+		const int32 CX = ClusterIndex % NumClustersX;
+		const int32 CY = ClusterIndex / NumClustersX;
+		Clusters[ClusterIndex].Bounds = FIntRect(
+			CX * ClusterSize, CY * ClusterSize,
+			FMath::Min((CX + 1) * ClusterSize, SizeX), FMath::Min((CY + 1) * ClusterSize, SizeY));
+	}
+
+	for (int32 ClusterIndex = 0; ClusterIndex < NumClusters; ClusterIndex++)
+	{
+		BuildBorder(ZoneTypeLayer, ClusterIndex, true);
+		BuildBorder(ZoneTypeLayer, ClusterIndex, false);
+	}
+
+	for (int32 ClusterIndex = 0; ClusterIndex < NumClusters; ClusterIndex++)
+	{
+		BuildClusterNodes(ZoneTypeLayer, ClusterIndex);
+	}
+
+	RebuildNodeOffsets();
+	RouteCache.Empty();
+	bBuilt = true;
+}
+
+void FZoneHierarchicalPathfinder::UpdateChangedCells(const TArray<uint8>& ZoneTypeLayer, const TArray<int32>& ChangedIndices)
+{
+	if (!bBuilt)
+		return;
+
+	TSet<int32> DirtyClusters;
+	for (int32 Index : ChangedIndices)
+	{
+		if (ZoneTypeLayer.IsValidIndex(Index))
+		{
+			DirtyClusters.Add(GetClusterIndex(Index));
+		}
+	}
+
+	if (DirtyClusters.Num() == 0)
+		return;
+
+	// Borders of dirty clusters changed, so their neighbours' entrance sets did too
+	TSet<int32> RebuildClusters;
+	for (int32 ClusterIndex : DirtyClusters)
+	{
+		const int32 CX = ClusterIndex % NumClustersX;
+		const int32 CY = ClusterIndex / NumClustersX;
+
+		BuildBorder(ZoneTypeLayer, ClusterIndex, true);
+		BuildBorder(ZoneTypeLayer, ClusterIndex, false);
+		RebuildClusters.Add(ClusterIndex);
+
+		if (CX > 0)
+		{
+			BuildBorder(ZoneTypeLayer, ClusterIndex - 1, true);
+			RebuildClusters.Add(ClusterIndex - 1);
+		}
+		if (CY > 0)
+		{
+			BuildBorder(ZoneTypeLayer, ClusterIndex - NumClustersX, false);
+			RebuildClusters.Add(ClusterIndex - NumClustersX);
+		}
+		if (CX + 1 < NumClustersX)
+		{
+			RebuildClusters.Add(ClusterIndex + 1);
+		}
+		if (CY + 1 < NumClustersY)
+		{
+			RebuildClusters.Add(ClusterIndex + NumClustersX);
+		}
+	}
+
+	for (int32 ClusterIndex : RebuildClusters)
+	{
+		BuildClusterNodes(ZoneTypeLayer, ClusterIndex);
+	}
+
+	RebuildNodeOffsets();
+	RouteCache.Empty();
+}
+
+void FZoneHierarchicalPathfinder::Reset()
+{
+	Clusters.Empty();
+	EastBorders.Empty();
+	NorthBorders.Empty();
+	NodeOffsets.Empty();
+	NodeClusters.Empty();
+	RouteCache.Empty();
+	bBuilt = false;
+}
+
+bool FZoneHierarchicalPathfinder::FindPath(const TArray<uint8>& ZoneTypeLayer, int32 StartIndex, int32 GoalIndex, TArray<int32>& OutCells) const
+{
+	OutCells.Reset();
+
+	if (!bBuilt || !ZoneTypeLayer.IsValidIndex(StartIndex) || !ZoneTypeLayer.IsValidIndex(GoalIndex))
+		return false;
+
+	if (!IsPassable(ZoneTypeLayer, StartIndex) || !IsPassable(ZoneTypeLayer, GoalIndex))
+		return false;
+
+	if (StartIndex == GoalIndex)
+	{
+		OutCells.Add(StartIndex);
+		return true;
+	}
+
+	const int32 StartCluster = GetClusterIndex(StartIndex);
+	const int32 GoalCluster = GetClusterIndex(GoalIndex);
+
+	// Short trips stay inside one cluster
+	if (StartCluster == GoalCluster && FindLocalPath(ZoneTypeLayer, StartIndex, GoalIndex, Clusters[StartCluster].Bounds, OutCells))
+		return true;
+
+	const uint64 CacheKey = (static_cast<uint64>(StartCluster) << 32) | static_cast<uint32>(GoalCluster);
+	if (const TArray<int32>* CachedRoute = RouteCache.Find(CacheKey))
+	{
+		if (RefineRoute(ZoneTypeLayer, StartIndex, GoalIndex, *CachedRoute, OutCells))
+			return true;
+	}
+
+	TArray<int32> NodeCells;
+	if (!FindAbstractRoute(ZoneTypeLayer, StartIndex, GoalIndex, NodeCells))
+	{
+		OutCells.Reset();
+		return false;
+	}
+
+	if (!RefineRoute(ZoneTypeLayer, StartIndex, GoalIndex, NodeCells, OutCells))
+	{
+		OutCells.Reset();
+		return false;
+	}
+
+	RouteCache.Add(CacheKey, MoveTemp(NodeCells));
+	return true;
+}
+
+int32 FZoneHierarchicalPathfinder::GetClusterIndex(int32 CellIndex) const
+{
+	const int32 X = CellIndex % SizeX;
+	const int32 Y = CellIndex / SizeX;
+	return (Y / ClusterSize) * NumClustersX + (X / ClusterSize);
+}
+
+bool FZoneHierarchicalPathfinder::IsPassable(const TArray<uint8>& ZoneTypeLayer, int32 CellIndex) const
+{
+	const uint8 ZoneType = ZoneTypeLayer[CellIndex];
+	return StepCosts.IsValidIndex(ZoneType) && StepCosts[ZoneType] > 0;
+}
+
+uint32 FZoneHierarchicalPathfinder::GetMoveCost(const TArray<uint8>& ZoneTypeLayer, int32 FromIndex, int32 ToIndex) const
+{
+	const int32 FromX = FromIndex % SizeX;
+	const int32 FromY = FromIndex / SizeX;
+	const int32 ToX = ToIndex % SizeX;
+	const int32 ToY = ToIndex / SizeX;
+	const int32 DeltaX = FMath::Abs(ToX - FromX);
+	const int32 DeltaY = FMath::Abs(ToY - FromY);
+
+	if (DeltaX > 1 || DeltaY > 1 || (DeltaX == 0 && DeltaY == 0))
+		return 0;
+
+	if (!IsPassable(ZoneTypeLayer, FromIndex) || !IsPassable(ZoneTypeLayer, ToIndex))
+		return 0;
+
+	const bool bDiagonal = DeltaX == 1 && DeltaY == 1;
+
+	// No corner cutting past blocked cells
+	if (bDiagonal && (!IsPassable(ZoneTypeLayer, FromY * SizeX + ToX) || !IsPassable(ZoneTypeLayer, ToY * SizeX + FromX)))
+		return 0;
+
+	const uint32 CostSum = StepCosts[ZoneTypeLayer[FromIndex]] + StepCosts[ZoneTypeLayer[ToIndex]];
+	return CostSum * (bDiagonal ? 14 : 10);
+}
+
+void FZoneHierarchicalPathfinder::BuildBorder(const TArray<uint8>& ZoneTypeLayer, int32 ClusterIndex, bool bEast)
+{
+	TArray<FTransition>& Border = bEast ? EastBorders[ClusterIndex] : NorthBorders[ClusterIndex];
+	Border.Reset();
+
+	const int32 CX = ClusterIndex % NumClustersX;
+	const int32 CY = ClusterIndex / NumClustersX;
+	if ((bEast && CX + 1 >= NumClustersX) || (!bEast && CY + 1 >= NumClustersY))
+		return;
+
+	const FIntRect& Bounds = Clusters[ClusterIndex].Bounds;
+	const int32 Length = bEast ? Bounds.Height() : Bounds.Width();
+
+	auto GetTransition = [&](int32 Offset) -> FTransition
+	{
+		if (bEast)
+		{
+			const int32 CellA = (Bounds.Min.Y + Offset) * SizeX + (Bounds.Max.X - 1);
+			return { CellA, CellA + 1 };
+		}
+		const int32 CellA = (Bounds.Max.Y - 1) * SizeX + (Bounds.Min.X + Offset);
+		return { CellA, CellA + SizeX };
+	};
+
+	// One entrance per open run (two for long runs)
+	int32 RunStart = INDEX_NONE;
+	for (int32 Offset = 0; Offset <= Length; Offset++)
+	{
+		bool bOpen = false;
+		if (Offset < Length)
+		{
+			const FTransition Transition = GetTransition(Offset);
+			bOpen = IsPassable(ZoneTypeLayer, Transition.CellA) && IsPassable(ZoneTypeLayer, Transition.CellB);
+		}
+
+		if (bOpen && RunStart == INDEX_NONE)
+		{
+			RunStart = Offset;
+		}
+		else if (!bOpen && RunStart != INDEX_NONE)
+		{
+			const int32 RunEnd = Offset - 1;
+			if (RunEnd - RunStart + 1 <= MaxSingleEntranceLength)
+			{
+				Border.Add(GetTransition((RunStart + RunEnd) / 2));
+			}
+			else
+			{
+				Border.Add(GetTransition(RunStart));
+				Border.Add(GetTransition(RunEnd));
+			}
+			RunStart = INDEX_NONE;
+		}
+	}
+}
+
+void FZoneHierarchicalPathfinder::BuildClusterNodes(const TArray<uint8>& ZoneTypeLayer, int32 ClusterIndex)
+{
+	FCluster& Cluster = Clusters[ClusterIndex];
+	Cluster.NodeCells.Reset();
+	Cluster.NodeLinks.Reset();
+
+	auto AddLink = [&Cluster](int32 Cell, int32 OtherCell)
+	{
+		int32 NodeIndex = Cluster.NodeCells.Find(Cell);
+		if (NodeIndex == INDEX_NONE)
+		{
+			NodeIndex = Cluster.NodeCells.Add(Cell);
+			Cluster.NodeLinks.AddDefaulted();
+		}
+		Cluster.NodeLinks[NodeIndex].AddUnique(OtherCell);
+	};
+
+	const int32 CX = ClusterIndex % NumClustersX;
+	const int32 CY = ClusterIndex / NumClustersX;
+
+	for (const FTransition& Transition : EastBorders[ClusterIndex])
+	{
+		AddLink(Transition.CellA, Transition.CellB);
+	}
+	for (const FTransition& Transition : NorthBorders[ClusterIndex])
+	{
+		AddLink(Transition.CellA, Transition.CellB);
+	}
+	if (CX > 0)
+	{
+		for (const FTransition& Transition : EastBorders[ClusterIndex - 1])
+		{
+			AddLink(Transition.CellB, Transition.CellA);
+		}
+	}
+	if (CY > 0)
+	{
+		for (const FTransition& Transition : NorthBorders[ClusterIndex - NumClustersX])
+		{
+			AddLink(Transition.CellB, Transition.CellA);
+		}
+	}
+
+	// Node-to-node costs, one bounded search per node
+	const int32 NumNodes = Cluster.NodeCells.Num();
+	const int32 BoundsWidth = Cluster.Bounds.Width();
+	Cluster.IntraCosts.Init(MAX_uint32, NumNodes * NumNodes);
+
+	TArray<uint32> Costs;
+	for (int32 From = 0; From < NumNodes; From++)
+	{
+		SearchInBounds(ZoneTypeLayer, Cluster.NodeCells[From], Cluster.Bounds, Costs, nullptr);
+		for (int32 To = 0; To < NumNodes; To++)
+		{
+			const int32 ToCell = Cluster.NodeCells[To];
+			const int32 Local = (ToCell / SizeX - Cluster.Bounds.Min.Y) * BoundsWidth + (ToCell % SizeX - Cluster.Bounds.Min.X);
+			Cluster.IntraCosts[From * NumNodes + To] = Costs[Local];
+		}
+	}
+}
+
+void FZoneHierarchicalPathfinder::RebuildNodeOffsets()
+{
+	NodeOffsets.SetNum(Clusters.Num() + 1);
+	NodeClusters.Reset();
+
+	NodeOffsets[0] = 0;
+	for (int32 ClusterIndex = 0; ClusterIndex < Clusters.Num(); ClusterIndex++)
+	{
+		const int32 NumNodes = Clusters[ClusterIndex].NodeCells.Num();
+		NodeOffsets[ClusterIndex + 1] = NodeOffsets[ClusterIndex] + NumNodes;
+		for (int32 Node = 0; Node < NumNodes; Node++)
+		{
+			NodeClusters.Add(ClusterIndex);
+		}
+	}
+}
+
+void FZoneHierarchicalPathfinder::SearchInBounds(const TArray<uint8>& ZoneTypeLayer, int32 StartIndex, const FIntRect& Bounds, TArray<uint32>& OutCosts, TArray<int32>* OutParents) const
+{
+	const int32 Width = Bounds.Width();
+	const int32 NumLocal = Width * Bounds.Height();
+
+	auto ToLocal = [&](int32 Cell) { return (Cell / SizeX - Bounds.Min.Y) * Width + (Cell % SizeX - Bounds.Min.X); };
+
+	OutCosts.Init(MAX_uint32, NumLocal);
+	if (OutParents)
+	{
+		OutParents->Init(INDEX_NONE, NumLocal);
+	}
+
+	TArray<FOpenNode> Open;
+	OutCosts[ToLocal(StartIndex)] = 0;
+	Open.HeapPush({ 0, StartIndex }, FOpenNodePredicate());
+
+	while (Open.Num() > 0)
+	{
+		FOpenNode Current;
+		Open.HeapPop(Current, FOpenNodePredicate(), EAllowShrinking::No);
+		if (Current.Cost > OutCosts[ToLocal(Current.Id)])
+			continue;
+
+		const int32 X = Current.Id % SizeX;
+		const int32 Y = Current.Id / SizeX;
+		for (int32 Dir = 0; Dir < 8; Dir++)
+		{
+			const int32 NX = X + NeighborOffsetsX[Dir];
+			const int32 NY = Y + NeighborOffsetsY[Dir];
+			if (!IsInBounds(Bounds, NX, NY))
+				continue;
+
+			const int32 NeighborIndex = NY * SizeX + NX;
+			const uint32 MoveCost = GetMoveCost(ZoneTypeLayer, Current.Id, NeighborIndex);
+			if (MoveCost == 0)
+				continue;
+
+			const int32 NeighborLocal = ToLocal(NeighborIndex);
+			const uint32 NewCost = Current.Cost + MoveCost;
+			if (NewCost < OutCosts[NeighborLocal])
+			{
+				OutCosts[NeighborLocal] = NewCost;
+				if (OutParents)
+				{
+					(*OutParents)[NeighborLocal] = Current.Id;
+				}
+				Open.HeapPush({ NewCost, NeighborIndex }, FOpenNodePredicate());
+			}
+		}
+	}
+}
+
+bool FZoneHierarchicalPathfinder::FindLocalPath(const TArray<uint8>& ZoneTypeLayer, int32 StartIndex, int32 GoalIndex, const FIntRect& Bounds, TArray<int32>& OutCells) const
+{
+	TArray<uint32> Costs;
+	TArray<int32> Parents;
+	SearchInBounds(ZoneTypeLayer, StartIndex, Bounds, Costs, &Parents);
+
+	const int32 Width = Bounds.Width();
+	auto ToLocal = [&](int32 Cell) { return (Cell / SizeX - Bounds.Min.Y) * Width + (Cell % SizeX - Bounds.Min.X); };
+
+	if (Costs[ToLocal(GoalIndex)] == MAX_uint32)
+		return false;
+
+	OutCells.Reset();
+	for (int32 Cell = GoalIndex; Cell != INDEX_NONE; Cell = Parents[ToLocal(Cell)])
+	{
+		OutCells.Add(Cell);
+	}
+	Algo::Reverse(OutCells);
+	return true;
+}
+
+bool FZoneHierarchicalPathfinder::FindAbstractRoute(const TArray<uint8>& ZoneTypeLayer, int32 StartIndex, int32 GoalIndex, TArray<int32>& OutNodeCells) const
+{
+	const int32 StartCluster = GetClusterIndex(StartIndex);
+	const int32 GoalCluster = GetClusterIndex(GoalIndex);
+	const int32 NumNodes = GetNumAbstractNodes();
+	const int32 StartId = NumNodes;
+	const int32 GoalId = NumNodes + 1;
+
+	// Temporary edges from the start and into the goal (costs are symmetric)
+	TArray<uint32> StartCosts;
+	TArray<uint32> GoalCosts;
+	SearchInBounds(ZoneTypeLayer, StartIndex, Clusters[StartCluster].Bounds, StartCosts, nullptr);
+	SearchInBounds(ZoneTypeLayer, GoalIndex, Clusters[GoalCluster].Bounds, GoalCosts, nullptr);
+
+	auto ToLocal = [this](int32 Cell, const FIntRect& Bounds)
+	{
+		return (Cell / SizeX - Bounds.Min.Y) * Bounds.Width() + (Cell % SizeX - Bounds.Min.X);
+	};
+
+	auto GetNodeCell = [&](int32 Id)
+	{
+		if (Id == StartId)
+			return StartIndex;
+		if (Id == GoalId)
+			return GoalIndex;
+		const int32 ClusterIndex = NodeClusters[Id];
+		return Clusters[ClusterIndex].NodeCells[Id - NodeOffsets[ClusterIndex]];
+	};
+
+	struct FNodeRecord
+	{
+		uint32 Cost;
+		int32 Parent;
+		bool bClosed;
+	};
+
+	TMap<int32, FNodeRecord> Records;
+	TArray<FOpenNode> Open;
+
+	Records.Add(StartId, { 0, INDEX_NONE, false });
+	Open.HeapPush({ GetHeuristic(StartIndex, GoalIndex), StartId }, FOpenNodePredicate());
+
+	auto Relax = [&](int32 FromId, uint32 FromCost, int32 ToId, int32 ToCell, uint32 EdgeCost)
+	{
+		const uint32 NewCost = FromCost + EdgeCost;
+		FNodeRecord* Record = Records.Find(ToId);
+		if (!Record)
+		{
+			Record = &Records.Add(ToId, { MAX_uint32, INDEX_NONE, false });
+		}
+		if (Record->bClosed || NewCost >= Record->Cost)
+			return;
+
+		Record->Cost = NewCost;
+		Record->Parent = FromId;
+		Open.HeapPush({ NewCost + GetHeuristic(ToCell, GoalIndex), ToId }, FOpenNodePredicate());
+	};
+
+	bool bFound = false;
+	while (Open.Num() > 0)
+	{
+		FOpenNode Current;
+		Open.HeapPop(Current, FOpenNodePredicate(), EAllowShrinking::No);
+
+		FNodeRecord& CurrentRecord = Records[Current.Id];
+		if (CurrentRecord.bClosed)
+			continue;
+		CurrentRecord.bClosed = true;
+
+		if (Current.Id == GoalId)
+		{
+			bFound = true;
+			break;
+		}
+
+		// Copy before relaxing - Records may reallocate
+		const uint32 CurrentCost = CurrentRecord.Cost;
+		const int32 CurrentCell = GetNodeCell(Current.Id);
+
+		if (Current.Id == StartId)
+		{
+			const FCluster& Cluster = Clusters[StartCluster];
+			for (int32 Node = 0; Node < Cluster.NodeCells.Num(); Node++)
+			{
+				const uint32 EdgeCost = StartCosts[ToLocal(Cluster.NodeCells[Node], Cluster.Bounds)];
+				if (EdgeCost != MAX_uint32)
+				{
+					Relax(Current.Id, CurrentCost, NodeOffsets[StartCluster] + Node, Cluster.NodeCells[Node], EdgeCost);
+				}
+			}
+			continue;
+		}
+
+		const int32 ClusterIndex = NodeClusters[Current.Id];
+		const FCluster& Cluster = Clusters[ClusterIndex];
+		const int32 NumClusterNodes = Cluster.NodeCells.Num();
+		const int32 LocalNode = Current.Id - NodeOffsets[ClusterIndex];
+
+		// Across the cluster
+		for (int32 Node = 0; Node < NumClusterNodes; Node++)
+		{
+			const uint32 EdgeCost = Cluster.IntraCosts[LocalNode * NumClusterNodes + Node];
+			if (Node != LocalNode && EdgeCost != MAX_uint32)
+			{
+				Relax(Current.Id, CurrentCost, NodeOffsets[ClusterIndex] + Node, Cluster.NodeCells[Node], EdgeCost);
+			}
+		}
+
+		// Across the border
+		for (int32 LinkCell : Cluster.NodeLinks[LocalNode])
+		{
+			const int32 LinkCluster = GetClusterIndex(LinkCell);
+			const int32 LinkNode = Clusters[LinkCluster].NodeCells.Find(LinkCell);
+			if (LinkNode != INDEX_NONE)
+			{
+				Relax(Current.Id, CurrentCost, NodeOffsets[LinkCluster] + LinkNode, LinkCell, GetMoveCost(ZoneTypeLayer, CurrentCell, LinkCell));
+			}
+		}
+
+		// Into the goal
+		if (ClusterIndex == GoalCluster)
+		{
+			const uint32 EdgeCost = GoalCosts[ToLocal(CurrentCell, Cluster.Bounds)];
+			if (EdgeCost != MAX_uint32)
+			{
+				Relax(Current.Id, CurrentCost, GoalId, GoalIndex, EdgeCost);
+			}
+		}
+	}
+
+	if (!bFound)
+		return false;
+
+	OutNodeCells.Reset();
+	for (int32 Id = Records[GoalId].Parent; Id != StartId && Id != INDEX_NONE; Id = Records[Id].Parent)
+	{
+		OutNodeCells.Add(GetNodeCell(Id));
+	}
+	Algo::Reverse(OutNodeCells);
+	return true;
+}
+
+bool FZoneHierarchicalPathfinder::RefineRoute(const TArray<uint8>& ZoneTypeLayer, int32 StartIndex, int32 GoalIndex, const TArray<int32>& NodeCells, TArray<int32>& OutCells) const
+{
+	OutCells.Reset();
+	OutCells.Add(StartIndex);
+
+	TArray<int32> Segment;
+	auto AppendSegment = [&](int32 FromCell, int32 ToCell)
+	{
+		if (FromCell == ToCell)
+			return true;
+
+		const int32 FromCluster = GetClusterIndex(FromCell);
+		if (FromCluster == GetClusterIndex(ToCell))
+		{
+			if (!FindLocalPath(ZoneTypeLayer, FromCell, ToCell, Clusters[FromCluster].Bounds, Segment))
+				return false;
+
+			for (int32 Step = 1; Step < Segment.Num(); Step++)
+			{
+				OutCells.Add(Segment[Step]);
+			}
+			return true;
+		}
+
+		// Entrance pair straddling a border
+		if (GetMoveCost(ZoneTypeLayer, FromCell, ToCell) == 0)
+			return false;
+
+		OutCells.Add(ToCell);
+		return true;
+	};
+
+	int32 CurrentCell = StartIndex;
+	for (int32 NodeCell : NodeCells)
+	{
+		if (!AppendSegment(CurrentCell, NodeCell))
+			return false;
+		CurrentCell = NodeCell;
+	}
+
+	return AppendSegment(CurrentCell, GoalIndex);
+}
+
+uint32 FZoneHierarchicalPathfinder::GetHeuristic(int32 FromIndex, int32 ToIndex) const
+{
+	// Octile distance at the cheapest possible move cost
+	const uint32 DeltaX = FMath::Abs(ToIndex % SizeX - FromIndex % SizeX);
+	const uint32 DeltaY = FMath::Abs(ToIndex / SizeX - FromIndex / SizeX);
+	const uint32 Octile = 10 * FMath::Max(DeltaX, DeltaY) + 4 * FMath::Min(DeltaX, DeltaY);
+	return Octile * 2 * MinStepCost;
+}
@@ -0,0 +1,117 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Hierarchical grid pathfinder (HPA*) over zone grid cells
+ * The grid is split into square clusters. Passable stretches along each
+ * cluster border become entrance nodes, and node-to-node costs inside every
+ * cluster are precomputed, so long routes search a small abstract graph and
+ * are only refined to cells cluster by cluster.
+ *
+ * - Move cost between neighbouring cells is (cost(a) + cost(b)) * step length,
+ *   symmetric so intra-cluster tables serve both directions; 0 = impassable
+ * - Abstract routes are cached by (start cluster, goal cluster) and reused
+ *   for any start/goal inside those clusters
+ * - Repainted cells only rebuild the borders and entrance tables of the
+ *   clusters they touch (and their neighbours)
+ */
+struct SIMULATOR_API FZoneHierarchicalPathfinder
+{
+	// Build cluster graph. StepCosts is indexed by zone type byte; 0 marks impassable zones.
+	void Build(const TArray<uint8>& ZoneTypeLayer, int32 InSizeX, int32 InSizeY, const TArray<uint32>& InStepCosts, int32 InClusterSize);
+
+	// Rebuild the clusters affected by changed cells
+	void UpdateChangedCells(const TArray<uint8>& ZoneTypeLayer, const TArray<int32>& ChangedIndices);
+
+	// Drop all data (graph must be rebuilt before next use)
+	void Reset();
+
+	bool IsBuilt() const { return bBuilt; }
+
+	// Cell route from start to goal (both included); false if either is impassable or unreachable
+	bool FindPath(const TArray<uint8>& ZoneTypeLayer, int32 StartIndex, int32 GoalIndex, TArray<int32>& OutCells) const;
+
+	// Number of entrance nodes in the abstract graph
+	int32 GetNumAbstractNodes() const { return NodeOffsets.Num() > 0 ? NodeOffsets.Last() : 0; }
+
+private:
+	// Passable cell pair straddling a cluster border (CellA in the lower-index cluster)
+	struct FTransition
+	{
+		int32 CellA;
+		int32 CellB;
+	};
+
+	struct FCluster
+	{
+		// Cell bounds (Min inclusive, Max exclusive)
+		FIntRect Bounds;
+
+		// Entrance node cells
+		TArray<int32> NodeCells;
+
+		// Per node: cells across the border it connects to
+		TArray<TArray<int32>> NodeLinks;
+
+		// Node-to-node cost inside the cluster (NodeCells.Num() squared, MAX_uint32 = unreachable)
+		TArray<uint32> IntraCosts;
+	};
+
+	int32 GetClusterIndex(int32 CellIndex) const;
+
+	bool IsPassable(const TArray<uint8>& ZoneTypeLayer, int32 CellIndex) const;
+
+	// Cost of stepping between two neighbouring cells (0 if blocked)
+	uint32 GetMoveCost(const TArray<uint8>& ZoneTypeLayer, int32 FromIndex, int32 ToIndex) const;
+
+	// Scan the border toward the +X (bEast) or +Y neighbour cluster for entrances
+	void BuildBorder(const TArray<uint8>& ZoneTypeLayer, int32 ClusterIndex, bool bEast);
+
+	// Collect entrance nodes from the four borders and compute intra-cluster costs
+	void BuildClusterNodes(const TArray<uint8>& ZoneTypeLayer, int32 ClusterIndex);
+
+	void RebuildNodeOffsets();
+
+	// Dijkstra restricted to Bounds; costs/parents indexed by local cell offset in Bounds
+	void SearchInBounds(const TArray<uint8>& ZoneTypeLayer, int32 StartIndex, const FIntRect& Bounds, TArray<uint32>& OutCosts, TArray<int32>* OutParents) const;
+
+	// Cell route staying inside Bounds
+	bool FindLocalPath(const TArray<uint8>& ZoneTypeLayer, int32 StartIndex, int32 GoalIndex, const FIntRect& Bounds, TArray<int32>& OutCells) const;
+
+	// A* over entrance nodes, outputs node cells along the route
+	bool FindAbstractRoute(const TArray<uint8>& ZoneTypeLayer, int32 StartIndex, int32 GoalIndex, TArray<int32>& OutNodeCells) const;
+
+	// Expand an abstract route into cells
+	bool RefineRoute(const TArray<uint8>& ZoneTypeLayer, int32 StartIndex, int32 GoalIndex, const TArray<int32>& NodeCells, TArray<int32>& OutCells) const;
+
+	// Admissible cost estimate between two cells
+	uint32 GetHeuristic(int32 FromIndex, int32 ToIndex) const;
+
+	TArray<FCluster> Clusters;
+
+	// Per cluster: entrances toward the +X / +Y neighbour
+	TArray<TArray<FTransition>> EastBorders;
+	TArray<TArray<FTransition>> NorthBorders;
+
+	// Prefix sum of node counts (global node id = offset of cluster + local index)
+	TArray<int32> NodeOffsets;
+
+	// Cluster of every global node id
+	TArray<int32> NodeClusters;
+
+	TArray<uint32> StepCosts;
+	uint32 MinStepCost = 1;
+
+	// Abstract routes keyed by (start cluster << 32 | goal cluster)
+	mutable TMap<uint64, TArray<int32>> RouteCache;
+
+	int32 SizeX = 0;
+	int32 SizeY = 0;
+	int32 ClusterSize = 16;
+	int32 NumClustersX = 0;
+	int32 NumClustersY = 0;
+	bool bBuilt = false;
+};
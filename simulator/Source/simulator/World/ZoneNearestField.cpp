@@ -0,0 +1,178 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ZoneNearestField.h"
+
+namespace
+{
+	const int32 NeighborOffsetsX[8] = { -1, 0, 1, -1, 1, -1, 0, 1 };
+	const int32 NeighborOffsetsY[8] = { -1, -1, -1, 0, 0, 1, 1, 1 };
+}
+
+void FZoneNearestField::Build(const TArray<uint8>& ZoneTypeLayer, int32 InSizeX, int32 InSizeY, uint8 InZoneType)
+{
+	SizeX = InSizeX;
+	SizeY = InSizeY;
+	ZoneType = InZoneType;
+
+	const int32 TotalCells = SizeX * SizeY;
+	if (TotalCells <= 0 || ZoneTypeLayer.Num() != TotalCells)
+	{
+		Reset();
+		return;
+	}
+
+	NearestIndex.Init(INDEX_NONE, TotalCells);
+	SourceReach.Init(0, TotalCells);
+
+	// Seed wavefront with every source cell
+	TArray<int32> Queue;
+	Queue.Reserve(TotalCells);
+	for (int32 Index = 0; Index < TotalCells; Index++)
+	{
+		if (ZoneTypeLayer[Index] == ZoneType)
+		{
+			NearestIndex[Index] = Index;
+			Queue.Add(Index);
+		}
+	}
+
+	Propagate(Queue);
+	bBuilt = true;
+}
+
+void FZoneNearestField::UpdateChangedCells(const TArray<uint8>& ZoneTypeLayer, const TArray<int32>& ChangedIndices)
+{
+	if (!bBuilt)
+		return;
+
+	TArray<int32> Queue;
+	TSet<int32> RemovedSources;
+
+	for (int32 Index : ChangedIndices)
+	{
+		if (!NearestIndex.IsValidIndex(Index))
+			continue;
+
+		if (ZoneTypeLayer[Index] == ZoneType)
+		{
+			// New source cell
+			if (NearestIndex[Index] != Index)
+			{
+				NearestIndex[Index] = Index;
+				SourceReach[Index] = 0;
+			}
+			Queue.Add(Index);
+		}
+		else if (NearestIndex[Index] == Index)
+		{
+			// Cell used to be a source
+			RemovedSources.Add(Index);
+		}
+	}
+
+	if (RemovedSources.Num() > 0)
+	{
+		// Clear every cell that points at a removed source. Flooding through neighbours is not
+		// enough - a cell can keep a source its neighbours were re-pointed away from - so scan
+		// the square each source's cells can reach.
+		TArray<int32> Invalidated;
+		for (int32 Source : RemovedSources)
+		{
+			const int32 SourceX = Source % SizeX;
+			const int32 SourceY = Source / SizeX;
+			const int32 Reach = SourceReach[Source];
+
+			const int32 MinX = FMath::Max(SourceX - Reach, 0);
+			const int32 MaxX = FMath::Min(SourceX + Reach, SizeX - 1);
+			const int32 MinY = FMath::Max(SourceY - Reach, 0);
+			const int32 MaxY = FMath::Min(SourceY + Reach, SizeY - 1);
+
+			for (int32 Y = MinY; Y <= MaxY; Y++)
+			{
+				for (int32 X = MinX; X <= MaxX; X++)
+				{
+					const int32 Index = Y * SizeX + X;
+					if (NearestIndex[Index] == Source)
+					{
+						NearestIndex[Index] = INDEX_NONE;
+						Invalidated.Add(Index);
+					}
+				}
+			}
+
+			SourceReach[Source] = 0;
+		}
+
+		// Re-seed cleared region from its valid border
+		for (int32 Index : Invalidated)
+		{
+			const int32 X = Index % SizeX;
+			const int32 Y = Index / SizeX;
+
+			for (int32 N = 0; N < 8; N++)
+			{
+				const int32 NX = X + NeighborOffsetsX[N];
+				const int32 NY = Y + NeighborOffsetsY[N];
+				if (NX < 0 || NX >= SizeX || NY < 0 || NY >= SizeY)
+					continue;
+
+				const int32 NeighborIndex = NY * SizeX + NX;
+				if (NearestIndex[NeighborIndex] != INDEX_NONE)
+				{
+					Queue.Add(NeighborIndex);
+				}
+			}
+		}
+	}
+
+	Propagate(Queue);
+}
+
+void FZoneNearestField::Reset()
+{
+	NearestIndex.Empty();
+	SourceReach.Empty();
+	bBuilt = false;
+}
+
+int64 FZoneNearestField::GetDistSquared(int32 FromIndex, int32 ToIndex) const
+{
+	const int64 DX = (FromIndex % SizeX) - (ToIndex % SizeX);
+	const int64 DY = (FromIndex / SizeX) - (ToIndex / SizeX);
+	return DX * DX + DY * DY;
+}
+
+void FZoneNearestField::Propagate(TArray<int32>& Queue)
+{
+	for (int32 Head = 0; Head < Queue.Num(); Head++)
+	{
+		const int32 Index = Queue[Head];
+		const int32 Source = NearestIndex[Index];
+		if (Source == INDEX_NONE)
+			continue;
+
+		const int32 X = Index % SizeX;
+		const int32 Y = Index / SizeX;
+
+		for (int32 N = 0; N < 8; N++)
+		{
+			const int32 NX = X + NeighborOffsetsX[N];
+			const int32 NY = Y + NeighborOffsetsY[N];
+			if (NX < 0 || NX >= SizeX || NY < 0 || NY >= SizeY)
+				continue;
+
+			const int32 NeighborIndex = NY * SizeX + NX;
+			const int32 Current = NearestIndex[NeighborIndex];
+
+			// Take this source if neighbour has none or it is strictly closer
+			if (Current == INDEX_NONE || GetDistSquared(NeighborIndex, Source) < GetDistSquared(NeighborIndex, Current))
+			{
+				NearestIndex[NeighborIndex] = Source;
+				Queue.Add(NeighborIndex);
+
+				const int32 Reach = FMath::Max(FMath::Abs(NX - Source % SizeX), FMath::Abs(NY - Source / SizeX));
+				SourceReach[Source] = static_cast<uint16>(FMath::Max<int32>(SourceReach[Source], Reach));
+			}
+		}
+	}
+}
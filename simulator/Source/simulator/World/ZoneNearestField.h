@@ -0,0 +1,51 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Nearest-cell field for a single zone type
+ * Stores, for every grid cell, the index of the closest cell of that zone type.
+ *
+ * - Built with a multi-source wavefront over the 8-connected grid
+ * - Patched locally when cells are repainted (only cells whose nearest
+ *   source changed are revisited; each source remembers how far out its
+ *   cells reach, so removing it only scans that square)
+ * - Lookups are a single array read
+ */
+struct SIMULATOR_API FZoneNearestField
+{
+	// Build field from scratch for all cells of the given zone type
+	void Build(const TArray<uint8>& ZoneTypeLayer, int32 InSizeX, int32 InSizeY, uint8 InZoneType);
+
+	// Patch field after the given cells changed zone type
+	void UpdateChangedCells(const TArray<uint8>& ZoneTypeLayer, const TArray<int32>& ChangedIndices);
+
+	// Drop all data (field must be rebuilt before next use)
+	void Reset();
+
+	bool IsBuilt() const { return bBuilt; }
+
+	// Index of nearest cell of this zone type (INDEX_NONE if zone type is absent)
+	int32 GetNearestIndex(int32 CellIndex) const
+	{
+		return NearestIndex.IsValidIndex(CellIndex) ? NearestIndex[CellIndex] : INDEX_NONE;
+	}
+
+private:
+	// Squared cell distance between two cell indices
+	int64 GetDistSquared(int32 FromIndex, int32 ToIndex) const;
+
+	// Relax neighbours of queued cells until no cell improves
+	void Propagate(TArray<int32>& Queue);
+
+	TArray<int32> NearestIndex;
+
+	// Per source cell: Chebyshev radius covering every cell that points at it (only grows until rebuilt)
+	TArray<uint16> SourceReach;
+	int32 SizeX = 0;
+	int32 SizeY = 0;
+	uint8 ZoneType = 0;
+	bool bBuilt = false;
+};
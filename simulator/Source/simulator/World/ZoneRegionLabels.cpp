@@ -0,0 +1,447 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ZoneRegionLabels.h"
+
+namespace
+{
+	const int32 NeighborOffsetsX[4] = { -1, 1, 0, 0 };
+	const int32 NeighborOffsetsY[4] = { 0, 0, -1, 1 };
+}
+
+void FZoneRegionLabels::Build(const TArray<uint8>& ZoneTypeLayer, const TArray<uint8>& RichnessLayer, int32 InSizeX, int32 InSizeY)
+{
+	SizeX = InSizeX;
+	SizeY = InSizeY;
+
+	const int32 TotalCells = SizeX * SizeY;
+	if (TotalCells <= 0 || ZoneTypeLayer.Num() != TotalCells || RichnessLayer.Num() != TotalCells)
+	{
+		Reset();
+		return;
+	}
+
+	CellRegion.Init(INDEX_NONE, TotalCells);
+	RegionParent.Reset();
+	Regions.Reset();
+	NumLiveRegions = 0;
+
+	// Flood fill every unlabeled cell
+	TArray<int32> Stack;
+	for (int32 StartIndex = 0; StartIndex < TotalCells; StartIndex++)
+	{
+		if (CellRegion[StartIndex] != INDEX_NONE)
+			continue;
+
+		const uint8 ZoneType = ZoneTypeLayer[StartIndex];
+		const int32 RegionId = CreateRegion(ZoneType);
+		CellRegion[StartIndex] = RegionId;
+		Stack.Add(StartIndex);
+
+		while (Stack.Num() > 0)
+		{
+			const int32 Index = Stack.Pop(EAllowShrinking::No);
+			AddCellToRegion(RegionId, Index, RichnessLayer[Index]);
+
+			const int32 X = Index % SizeX;
+			const int32 Y = Index / SizeX;
+			for (int32 Dir = 0; Dir < 4; Dir++)
+			{
+				const int32 NX = X + NeighborOffsetsX[Dir];
+				const int32 NY = Y + NeighborOffsetsY[Dir];
+				if (NX < 0 || NX >= SizeX || NY < 0 || NY >= SizeY)
+					continue;
+
+				const int32 NeighborIndex = NY * SizeX + NX;
+				if (CellRegion[NeighborIndex] == INDEX_NONE && ZoneTypeLayer[NeighborIndex] == ZoneType)
+				{
+					CellRegion[NeighborIndex] = RegionId;
+					Stack.Add(NeighborIndex);
+				}
+			}
+		}
+	}
+
+	bBuilt = true;
+}
+
+void FZoneRegionLabels::UpdateChangedCells(const TArray<uint8>& ZoneTypeLayer, const TArray<uint8>& RichnessLayer, const TArray<int32>& ChangedIndices)
+{
+	if (!bBuilt)
+		return;
+
+	// Ids are never reused - relabel from scratch once dead ids dominate
+	if (Regions.Num() + ChangedIndices.Num() > CellRegion.Num() * 2)
+	{
+		Build(ZoneTypeLayer, RichnessLayer, SizeX, SizeY);
+		return;
+	}
+
+	// 1. Detach changed cells from their old regions
+	TSet<int32> ShrunkRegions;
+	for (int32 Index : ChangedIndices)
+	{
+		if (!CellRegion.IsValidIndex(Index) || CellRegion[Index] == INDEX_NONE)
+			continue;
+
+		const int32 Root = FindRoot(CellRegion[Index]);
+		RemoveCellFromRegion(Root, Index, RichnessLayer[Index]);
+		CellRegion[Index] = INDEX_NONE;
+		ShrunkRegions.Add(Root);
+	}
+
+	// 2. Re-attach them as single-cell regions and merge with equal neighbours
+	for (int32 Index : ChangedIndices)
+	{
+		if (!CellRegion.IsValidIndex(Index) || CellRegion[Index] != INDEX_NONE)
+			continue;
+
+		const uint8 ZoneType = ZoneTypeLayer[Index];
+		int32 Root = CreateRegion(ZoneType);
+		CellRegion[Index] = Root;
+		AddCellToRegion(Root, Index, RichnessLayer[Index]);
+
+		const int32 X = Index % SizeX;
+		const int32 Y = Index / SizeX;
+		for (int32 Dir = 0; Dir < 4; Dir++)
+		{
+			const int32 NX = X + NeighborOffsetsX[Dir];
+			const int32 NY = Y + NeighborOffsetsY[Dir];
+			if (NX < 0 || NX >= SizeX || NY < 0 || NY >= SizeY)
+				continue;
+
+			const int32 NeighborIndex = NY * SizeX + NX;
+			if (CellRegion[NeighborIndex] != INDEX_NONE && ZoneTypeLayer[NeighborIndex] == ZoneType)
+			{
+				Root = MergeRegions(Root, FindRoot(CellRegion[NeighborIndex]));
+			}
+		}
+	}
+
+	// Shrunk regions may have been merged into others since step 1
+	TSet<int32> AffectedRoots;
+	for (int32 RegionId : ShrunkRegions)
+	{
+		const int32 Root = FindRoot(RegionId);
+		if (Regions[Root].Area == 0)
+		{
+			// Fully painted over
+			NumLiveRegions--;
+			continue;
+		}
+		AffectedRoots.Add(Root);
+	}
+
+	if (AffectedRoots.Num() == 0)
+		return;
+
+	// 3. Cells bordering the cut are the only places a region can have come apart
+	TMap<int32, TArray<int32>> SeedsByRoot;
+	for (int32 Index : ChangedIndices)
+	{
+		if (!CellRegion.IsValidIndex(Index))
+			continue;
+
+		const int32 X = Index % SizeX;
+		const int32 Y = Index / SizeX;
+		for (int32 Dir = 0; Dir < 4; Dir++)
+		{
+			const int32 NX = X + NeighborOffsetsX[Dir];
+			const int32 NY = Y + NeighborOffsetsY[Dir];
+			if (NX < 0 || NX >= SizeX || NY < 0 || NY >= SizeY)
+				continue;
+
+			const int32 NeighborIndex = NY * SizeX + NX;
+			const int32 Root = FindRoot(CellRegion[NeighborIndex]);
+			if (AffectedRoots.Contains(Root))
+			{
+				SeedsByRoot.FindOrAdd(Root).AddUnique(NeighborIndex);
+			}
+		}
+	}
+
+	for (TPair<int32, TArray<int32>>& Pair : SeedsByRoot)
+	{
+		if (Pair.Value.Num() > 1)
+		{
+			SplitRegion(Pair.Key, Pair.Value, RichnessLayer);
+		}
+	}
+
+	for (int32 Root : AffectedRoots)
+	{
+		ShrinkBounds(Root);
+	}
+}
+
+void FZoneRegionLabels::Reset()
+{
+	CellRegion.Empty();
+	RegionParent.Empty();
+	Regions.Empty();
+	NumLiveRegions = 0;
+	bBuilt = false;
+}
+
+int32 FZoneRegionLabels::FindRoot(int32 RegionId) const
+{
+	while (RegionParent[RegionId] != RegionId)
+	{
+		RegionParent[RegionId] = RegionParent[RegionParent[RegionId]];
+		RegionId = RegionParent[RegionId];
+	}
+	return RegionId;
+}
+
+int32 FZoneRegionLabels::CreateRegion(uint8 ZoneType)
+{
+	const int32 RegionId = Regions.AddDefaulted();
+	Regions[RegionId].ZoneType = ZoneType;
+	RegionParent.Add(RegionId);
+	NumLiveRegions++;
+	return RegionId;
+}
+
+int32 FZoneRegionLabels::MergeRegions(int32 RootA, int32 RootB)
+{
+	if (RootA == RootB)
+		return RootA;
+
+	if (Regions[RootA].Area < Regions[RootB].Area)
+	{
+		Swap(RootA, RootB);
+	}
+
+	FRegion& Into = Regions[RootA];
+	FRegion& From = Regions[RootB];
+
+	Into.Min.X = FMath::Min(Into.Min.X, From.Min.X);
+	Into.Min.Y = FMath::Min(Into.Min.Y, From.Min.Y);
+	Into.Max.X = FMath::Max(Into.Max.X, From.Max.X);
+	Into.Max.Y = FMath::Max(Into.Max.Y, From.Max.Y);
+	Into.Area += From.Area;
+	Into.SumX += From.SumX;
+	Into.SumY += From.SumY;
+	Into.RichnessSum += From.RichnessSum;
+
+	From = FRegion();
+	RegionParent[RootB] = RootA;
+	NumLiveRegions--;
+	return RootA;
+}
+
+void FZoneRegionLabels::AddCellToRegion(int32 RegionId, int32 CellIndex, uint8 Richness)
+{
+	FRegion& Region = Regions[RegionId];
+	const int32 X = CellIndex % SizeX;
+	const int32 Y = CellIndex / SizeX;
+
+	if (Region.Area == 0)
+	{
+		Region.Min = FIntPoint(X, Y);
+		Region.Max = FIntPoint(X, Y);
+	}
+	else
+	{
+		Region.Min.X = FMath::Min(Region.Min.X, X);
+		Region.Min.Y = FMath::Min(Region.Min.Y, Y);
+		Region.Max.X = FMath::Max(Region.Max.X, X);
+		Region.Max.Y = FMath::Max(Region.Max.Y, Y);
+	}
+
+	Region.Area++;
+	Region.SumX += X;
+	Region.SumY += Y;
+	Region.RichnessSum += Richness;
+}
+
+void FZoneRegionLabels::RemoveCellFromRegion(int32 RegionId, int32 CellIndex, uint8 Richness)
+{
+	// Bounds stay conservative here and are tightened by ShrinkBounds
+	FRegion& Region = Regions[RegionId];
+	Region.Area--;
+	Region.SumX -= CellIndex % SizeX;
+	Region.SumY -= CellIndex / SizeX;
+	Region.RichnessSum -= Richness;
+}
+
+void FZoneRegionLabels::SplitRegion(int32 Root, const TArray<int32>& Seeds, const TArray<uint8>& RichnessLayer)
+{
+	// One BFS per seed, advanced in lockstep. Searches that meet are the same
+	// piece; once at most one piece is still growing, every finished piece is
+	// complete, so the cost is bounded by the smaller pieces, not the region.
+	TMap<int32, int32> VisitedGroup;
+	TArray<int32> GroupParent;
+	TArray<TArray<int32>> Queues;
+	TArray<int32> QueueHeads;
+
+	auto FindGroup = [&GroupParent](int32 Group)
+	{
+		while (GroupParent[Group] != Group)
+		{
+			GroupParent[Group] = GroupParent[GroupParent[Group]];
+			Group = GroupParent[Group];
+		}
+		return Group;
+	};
+
+	for (int32 Seed : Seeds)
+	{
+		if (VisitedGroup.Contains(Seed))
+			continue;
+
+		const int32 Group = Queues.Num();
+		GroupParent.Add(Group);
+		Queues.AddDefaulted_GetRef().Add(Seed);
+		QueueHeads.Add(0);
+		VisitedGroup.Add(Seed, Group);
+	}
+
+	TArray<bool> GroupGrowing;
+	while (true)
+	{
+		for (int32 Group = 0; Group < Queues.Num(); Group++)
+		{
+			if (QueueHeads[Group] >= Queues[Group].Num())
+				continue;
+
+			const int32 Index = Queues[Group][QueueHeads[Group]++];
+			const int32 X = Index % SizeX;
+			const int32 Y = Index / SizeX;
+			for (int32 Dir = 0; Dir < 4; Dir++)
+			{
+				const int32 NX = X + NeighborOffsetsX[Dir];
+				const int32 NY = Y + NeighborOffsetsY[Dir];
+				if (NX < 0 || NX >= SizeX || NY < 0 || NY >= SizeY)
+					continue;
+
+				const int32 NeighborIndex = NY * SizeX + NX;
+				if (CellRegion[NeighborIndex] == INDEX_NONE || FindRoot(CellRegion[NeighborIndex]) != Root)
+					continue;
+
+				if (const int32* OtherGroup = VisitedGroup.Find(NeighborIndex))
+				{
+					const int32 GroupRoot = FindGroup(Group);
+					const int32 OtherRoot = FindGroup(*OtherGroup);
+					if (GroupRoot != OtherRoot)
+					{
+						GroupParent[OtherRoot] = GroupRoot;
+					}
+					continue;
+				}
+
+				VisitedGroup.Add(NeighborIndex, Group);
+				Queues[Group].Add(NeighborIndex);
+			}
+		}
+
+		// A piece keeps growing while any of its merged searches has work left
+		GroupGrowing.Init(false, Queues.Num());
+		int32 NumPieces = 0;
+		int32 NumGrowing = 0;
+		for (int32 Group = 0; Group < Queues.Num(); Group++)
+		{
+			const int32 GroupRoot = FindGroup(Group);
+			if (GroupRoot == Group)
+			{
+				NumPieces++;
+			}
+			if (QueueHeads[Group] < Queues[Group].Num() && !GroupGrowing[GroupRoot])
+			{
+				GroupGrowing[GroupRoot] = true;
+				NumGrowing++;
+			}
+		}
+
+		if (NumPieces <= 1)
+			return;
+
+		if (NumGrowing <= 1)
+			break;
+	}
+
+	// The growing piece (or the largest one if all finished) keeps the old id
+	int32 KeepGroup = INDEX_NONE;
+	TMap<int32, int32> PieceSizes;
+	for (const TPair<int32, int32>& Pair : VisitedGroup)
+	{
+		PieceSizes.FindOrAdd(FindGroup(Pair.Value))++;
+	}
+	for (const TPair<int32, int32>& Pair : PieceSizes)
+	{
+		if (GroupGrowing[Pair.Key])
+		{
+			KeepGroup = Pair.Key;
+			break;
+		}
+		if (KeepGroup == INDEX_NONE || Pair.Value > PieceSizes[KeepGroup])
+		{
+			KeepGroup = Pair.Key;
+		}
+	}
+
+	const uint8 ZoneType = Regions[Root].ZoneType;
+	TMap<int32, int32> PieceRegions;
+	for (const TPair<int32, int32>& Pair : VisitedGroup)
+	{
+		const int32 GroupRoot = FindGroup(Pair.Value);
+		if (GroupRoot == KeepGroup)
+			continue;
+
+		int32* NewRegion = PieceRegions.Find(GroupRoot);
+		if (!NewRegion)
+		{
+			NewRegion = &PieceRegions.Add(GroupRoot, CreateRegion(ZoneType));
+		}
+
+		const int32 Index = Pair.Key;
+		CellRegion[Index] = *NewRegion;
+		RemoveCellFromRegion(Root, Index, RichnessLayer[Index]);
+		AddCellToRegion(*NewRegion, Index, RichnessLayer[Index]);
+	}
+}
+
+void FZoneRegionLabels::ShrinkBounds(int32 Root)
+{
+	FRegion& Region = Regions[Root];
+	if (Region.Area == 0)
+		return;
+
+	while (Region.Min.Y < Region.Max.Y && !RowHasRegionCell(Root, Region.Min.Y, Region.Min.X, Region.Max.X))
+	{
+		Region.Min.Y++;
+	}
+	while (Region.Max.Y > Region.Min.Y && !RowHasRegionCell(Root, Region.Max.Y, Region.Min.X, Region.Max.X))
+	{
+		Region.Max.Y--;
+	}
+	while (Region.Min.X < Region.Max.X && !ColumnHasRegionCell(Root, Region.Min.X, Region.Min.Y, Region.Max.Y))
+	{
+		Region.Min.X++;
+	}
+	while (Region.Max.X > Region.Min.X && !ColumnHasRegionCell(Root, Region.Max.X, Region.Min.Y, Region.Max.Y))
+	{
+		Region.Max.X--;
+	}
+}
+
+bool FZoneRegionLabels::RowHasRegionCell(int32 Root, int32 Y, int32 MinX, int32 MaxX) const
+{
+	for (int32 X = MinX; X <= MaxX; X++)
+	{
+		const int32 Label = CellRegion[Y * SizeX + X];
+		if (Label != INDEX_NONE && FindRoot(Label) == Root)
+			return true;
+	}
+	return false;
+}
+
+bool FZoneRegionLabels::ColumnHasRegionCell(int32 Root, int32 X, int32 MinY, int32 MaxY) const
+{
+	for (int32 Y = MinY; Y <= MaxY; Y++)
+	{
+		const int32 Label = CellRegion[Y * SizeX + X];
+		if (Label != INDEX_NONE && FindRoot(Label) == Root)
+			return true;
+	}
+	return false;
+}
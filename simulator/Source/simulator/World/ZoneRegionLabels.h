@@ -0,0 +1,99 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Connected-region labels for the zone grid
+ * Every cell belongs to exactly one 4-connected region of equal zone type.
+ *
+ * - Built with one flood fill over the grid
+ * - Repainted cells are relabeled locally: new cells join neighbours through
+ *   union-find merges, and regions that lost cells are only re-flooded from
+ *   the cut edge until all but one piece is exhausted
+ * - Region stats (area, bounds, centroid sums, richness sum) are kept per
+ *   root so lookups are O(1) apart from the near-constant union-find walk
+ *
+ * Region ids are union-find roots and change when regions merge or split.
+ */
+struct SIMULATOR_API FZoneRegionLabels
+{
+	// Aggregated stats of one region
+	struct FRegion
+	{
+		uint8 ZoneType = 0;
+		int32 Area = 0;
+		int64 SumX = 0;
+		int64 SumY = 0;
+
+		// Sum of quantized richness (255 per full cell)
+		int64 RichnessSum = 0;
+
+		// Inclusive cell bounds
+		FIntPoint Min = FIntPoint(0, 0);
+		FIntPoint Max = FIntPoint(0, 0);
+	};
+
+	// Label all cells from scratch
+	void Build(const TArray<uint8>& ZoneTypeLayer, const TArray<uint8>& RichnessLayer, int32 InSizeX, int32 InSizeY);
+
+	// Relabel after the given cells changed zone type
+	void UpdateChangedCells(const TArray<uint8>& ZoneTypeLayer, const TArray<uint8>& RichnessLayer, const TArray<int32>& ChangedIndices);
+
+	// Drop all data (labels must be rebuilt before next use)
+	void Reset();
+
+	bool IsBuilt() const { return bBuilt; }
+
+	// Region id of a cell (INDEX_NONE if out of range)
+	int32 GetRegionId(int32 CellIndex) const
+	{
+		return CellRegion.IsValidIndex(CellIndex) ? FindRoot(CellRegion[CellIndex]) : INDEX_NONE;
+	}
+
+	// Stats of a live region (nullptr for stale or empty ids)
+	const FRegion* GetRegion(int32 RegionId) const
+	{
+		if (!Regions.IsValidIndex(RegionId) || RegionParent[RegionId] != RegionId || Regions[RegionId].Area == 0)
+			return nullptr;
+		return &Regions[RegionId];
+	}
+
+	// Number of live regions
+	int32 GetNumRegions() const { return NumLiveRegions; }
+
+private:
+	// Union-find root with path halving
+	int32 FindRoot(int32 RegionId) const;
+
+	int32 CreateRegion(uint8 ZoneType);
+
+	// Merge two roots (larger area wins), returns surviving root
+	int32 MergeRegions(int32 RootA, int32 RootB);
+
+	void AddCellToRegion(int32 RegionId, int32 CellIndex, uint8 Richness);
+	void RemoveCellFromRegion(int32 RegionId, int32 CellIndex, uint8 Richness);
+
+	// Re-flood a region from cells next to removed ones and split off detached pieces
+	void SplitRegion(int32 Root, const TArray<int32>& Seeds, const TArray<uint8>& RichnessLayer);
+
+	// Tighten bounds after cells were removed
+	void ShrinkBounds(int32 Root);
+
+	// Does the row / column segment contain a cell of the region?
+	bool RowHasRegionCell(int32 Root, int32 Y, int32 MinX, int32 MaxX) const;
+	bool ColumnHasRegionCell(int32 Root, int32 X, int32 MinY, int32 MaxY) const;
+
+	// Region label per cell (possibly a non-root member of its set)
+	TArray<int32> CellRegion;
+
+	// Union-find parent per region id (mutable for path halving in const lookups)
+	mutable TArray<int32> RegionParent;
+
+	TArray<FRegion> Regions;
+	int32 NumLiveRegions = 0;
+	int32 SizeX = 0;
+	int32 SizeY = 0;
+	bool bBuilt = false;
+};
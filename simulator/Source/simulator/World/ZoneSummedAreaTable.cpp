@@ -0,0 +1,67 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ZoneSummedAreaTable.h"
+
+void FZoneSummedAreaTable::BuildCount(const TArray<uint8>& ZoneTypeLayer, int32 InSizeX, int32 InSizeY, uint8 InZoneType)
+{
+	bCountZoneType = true;
+	ZoneType = InZoneType;
+	BuildSum(ZoneTypeLayer, InSizeX, InSizeY);
+}
+
+void FZoneSummedAreaTable::BuildSum(const TArray<uint8>& ValueLayer, int32 InSizeX, int32 InSizeY)
+{
+	SizeX = InSizeX;
+	SizeY = InSizeY;
+
+	if (SizeX <= 0 || SizeY <= 0 || ValueLayer.Num() != SizeX * SizeY)
+	{
+		Reset();
+		return;
+	}
+
+	Table.SetNumZeroed((SizeX + 1) * (SizeY + 1));
+	Accumulate(ValueLayer, 0, 0);
+	bBuilt = true;
+}
+
+void FZoneSummedAreaTable::UpdateChangedCells(const TArray<uint8>& Layer, const TArray<int32>& ChangedIndices)
+{
+	if (!bBuilt || ChangedIndices.Num() == 0)
+		return;
+
+	// Every entry right of and below the top-left-most change depends on it
+	int32 StartX = SizeX;
+	int32 StartY = SizeY;
+	for (int32 Index : ChangedIndices)
+	{
+		StartX = FMath::Min(StartX, Index % SizeX);
+		StartY = FMath::Min(StartY, Index / SizeX);
+	}
+
+	Accumulate(Layer, StartX, StartY);
+}
+
+void FZoneSummedAreaTable::Reset()
+{
+	Table.Empty();
+	bBuilt = false;
+}
+
+void FZoneSummedAreaTable::Accumulate(const TArray<uint8>& Layer, int32 StartX, int32 StartY)
+{
+	const int32 Stride = SizeX + 1;
+	uint32* RESTRICT Data = Table.GetData();
+	const uint8* RESTRICT Cells = Layer.GetData();
+
+	for (int32 Y = StartY; Y < SizeY; Y++)
+	{
+		// Running sum of this row up to StartX, then standard recurrence
+		uint32 RowSum = Data[(Y + 1) * Stride + StartX] - Data[Y * Stride + StartX];
+		for (int32 X = StartX; X < SizeX; X++)
+		{
+			RowSum += GetCellValue(Cells[Y * SizeX + X]);
+			Data[(Y + 1) * Stride + (X + 1)] = Data[Y * Stride + (X + 1)] + RowSum;
+		}
+	}
+}
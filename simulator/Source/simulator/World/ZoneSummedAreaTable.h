@@ -0,0 +1,61 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Summed-area table (integral image) over one zone grid layer
+ * Answers "sum over any cell rectangle" with four reads.
+ *
+ * - Count mode: each cell contributes 1 if it holds the given zone type
+ * - Value mode: each cell contributes its layer byte (e.g. quantized richness)
+ * - Repainted cells only recompute the part of the table below/right of the
+ *   earliest changed cell
+ *
+ * Sums are kept in uint32 with wrap-around; rectangle differences stay exact
+ * as long as the true rectangle sum fits (255 * 4096 * 4096 does).
+ */
+struct SIMULATOR_API FZoneSummedAreaTable
+{
+	// Build table counting cells of one zone type
+	void BuildCount(const TArray<uint8>& ZoneTypeLayer, int32 InSizeX, int32 InSizeY, uint8 InZoneType);
+
+	// Build table summing raw layer values
+	void BuildSum(const TArray<uint8>& ValueLayer, int32 InSizeX, int32 InSizeY);
+
+	// Recompute the region affected by changed cells
+	void UpdateChangedCells(const TArray<uint8>& Layer, const TArray<int32>& ChangedIndices);
+
+	// Drop all data (table must be rebuilt before next use)
+	void Reset();
+
+	bool IsBuilt() const { return bBuilt; }
+
+	// Sum over the inclusive cell rectangle [MinX, MaxX] x [MinY, MaxY] (caller clamps to the grid)
+	uint32 GetRectSum(int32 MinX, int32 MinY, int32 MaxX, int32 MaxY) const
+	{
+		const int32 Stride = SizeX + 1;
+		return Table[(MaxY + 1) * Stride + (MaxX + 1)]
+			- Table[MinY * Stride + (MaxX + 1)]
+			- Table[(MaxY + 1) * Stride + MinX]
+			+ Table[MinY * Stride + MinX];
+	}
+
+private:
+	// Fill table entries for cells [StartX, SizeX) x [StartY, SizeY)
+	void Accumulate(const TArray<uint8>& Layer, int32 StartX, int32 StartY);
+
+	uint32 GetCellValue(uint8 LayerValue) const
+	{
+		return bCountZoneType ? (LayerValue == ZoneType ? 1u : 0u) : LayerValue;
+	}
+
+	// (SizeX + 1) * (SizeY + 1) entries, first row and column are zero
+	TArray<uint32> Table;
+	int32 SizeX = 0;
+	int32 SizeY = 0;
+	uint8 ZoneType = 0;
+	bool bCountZoneType = false;
+	bool bBuilt = false;
+};